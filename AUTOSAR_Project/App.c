@@ -13,8 +13,14 @@
 #include "Button.h"
 #include "Led.h"
 #include "Dio.h"
+#include "Gpt.h"
+#include "Irq.h"
 #include "Mcu.h"
 #include "Port.h"
+#include "Os.h"
+#include "Os_Server.h"
+
+static void App_ButtonEventJob(uint32 Argument);
 
 /* Description: Task executes once to initialize all the Modules */
 void Init_Task(void)
@@ -27,12 +33,24 @@ void Init_Task(void)
     /* Initialize Dio Driver */
     Dio_Init(&Dio_Configuration);
 
+    /* Initialize Gpt Driver, the SysTick of the Os is already running */
+    Gpt_Init(&Gpt_Configuration);
 
+#if (IRQ_PRIORITY_REPORT == STD_ON)
+    /* Every interrupt is installed and enabled: report the priorities the exclusive areas
+     * do not protect or hold off for nothing */
+    (void)Irq_CheckPriorities();
+    Irq_DumpPriorityReport();
+#endif
 }
 
 /* Description: Task executes every 20 Mili-seconds to check the button state */
 void Button_Task(void)
 {
+#if (OS_LET == STD_OFF)
+    /* With the logical execution time the Os latches the switch at the release of the task */
+    Button_LatchInput();
+#endif
     Button_RefreshState();
 }
 
@@ -40,22 +58,61 @@ void Button_Task(void)
 void Led_Task(void)
 {
     Led_RefreshOutput();
+#if (OS_LET == STD_OFF)
+    /* With the logical execution time the Os writes the LED at the end of the period of the task */
+    Led_CommitOutput();
+#endif
 }
 
-/* Description: Task executes every 60 Mili-seconds to get the button status and toggle the led */
-void App_Task(void)
+/* Description: Notification of a button state change, called by Button_Task */
+void App_ButtonNotification(void)
 {
-    static uint8 button_previous_state = BUTTON_RELEASED;
-    static uint8 button_current_state  = BUTTON_RELEASED;
+#if (OS_APERIODIC_SERVER == STD_ON)
+    /* The reaction runs right after Button_Task instead of waiting for a periodic task */
+    (void)Os_ServerSubmit(App_ButtonEventJob, 0);
+#else
+    App_ButtonEventJob(0);
+#endif
+}
 
-    button_current_state = Button_GetState(); /* Read the button state */
+/* Description: Job of the aperiodic server to get the button events and toggle the led */
+static void App_ButtonEventJob(uint32 Argument)
+{
+    uint8 button_event;
 
-    /* Only Toggle the led in case the current state of the switch is pressed
-     * and the previous state is released */ 
-    if((button_current_state == BUTTON_PRESSED) && (button_previous_state == BUTTON_RELEASED))
+    (void)Argument;
+    /* Toggle the led on every press streamed by Button_Task, a job finding the queue empty
+     * was submitted for an event already handled by the previous one */
+    while(Os_IocReceive(OsConf_BUTTON_EVENTS_QUEUE_ID, &button_event) == E_OK)
     {
-        Led_Toggle();
+        if(button_event == BUTTON_PRESSED)
+        {
+            Led_Toggle();
+        }
     }
+}
+
+/*
+ * Description: Protection hook of the Os: a task running longer than its budget gives the time back
+ *              by dropping its next activation, a task still running one more budget later is stuck
+ *              and only a reset recovers the tasks it starves. A missed deadline is only counted.
+ */
+Os_ProtectionReturnType App_ProtectionHook(Os_TaskType TaskId, Os_ProtectionErrorType Error)
+{
+    Os_ProtectionReturnType Reaction = OS_PRO_IGNORE;
 
-    button_previous_state = button_current_state;
+    (void)TaskId;
+    if(Error == OS_PROTECTION_BUDGET)
+    {
+        Reaction = OS_PRO_SKIP_ACTIVATION;
+    }
+    else if(Error == OS_PROTECTION_RUNAWAY)
+    {
+        Reaction = OS_PRO_RESET;
+    }
+    else
+    {
+        /* OS_PROTECTION_DEADLINE: see Os_GetTaskProtectionStatus */
+    }
+    return Reaction;
 }
@@ -23,7 +23,7 @@ void Button_Task(void);
 /* Description: Task executes every 40 Mili-seconds to refresh the LED */
 void Led_Task(void);
 
-/* Description: Task executes every 60 Mili-seconds to get the button status and toggle the led */
-void App_Task(void);
+/* Description: Notification of a button state change, hands the button events to the aperiodic server */
+void App_ButtonNotification(void);
 
 #endif /* APP_H_ */
@@ -10,23 +10,56 @@
  ******************************************************************************/
 #include "Dio.h"
 #include "Button.h"
+#include "Os.h"
 
 
 
-/* Global variable to hold the button state */
+/* Global variable to hold the button state, written by Button_Task and read by the jobs of
+ * Os_ServerTask through Button_GetState: accessed under the Os resource Button_State */
 static uint8 g_button_state = BUTTON_RELEASED;
 
+/* Switch level read by the last Button_LatchInput, debounced by Button_RefreshState */
+static uint8 g_button_sample = BUTTON_RELEASED;
+
+static void Button_SetState(uint8 state);
+
+/*******************************************************************************************************************/
+static void Button_SetState(uint8 state)
+{
+    /* Every change is also streamed to the Button_Events queue: a press shorter than the
+     * period of the reader is not lost */
+    if(state != g_button_state)
+    {
+        (void)Os_GetResource(OsConf_BUTTON_STATE_RESOURCE_ID);
+        g_button_state = state;
+        (void)Os_ReleaseResource(OsConf_BUTTON_STATE_RESOURCE_ID);
+        (void)Os_IocSend(OsConf_BUTTON_EVENTS_QUEUE_ID, &state);
+        BUTTON_EVENT_NOTIFICATION();
+    }
+}
 
 /*******************************************************************************************************************/
+/* Only for the tasks using the Button_State resource in Os_Cfg.json: Button_Task and Os_ServerTask */
 uint8 Button_GetState(void)
 {
-    return g_button_state;
+    uint8 state;
+
+    (void)Os_GetResource(OsConf_BUTTON_STATE_RESOURCE_ID);
+    state = g_button_state;
+    (void)Os_ReleaseResource(OsConf_BUTTON_STATE_RESOURCE_ID);
+    return state;
+}
+
+/*******************************************************************************************************************/
+void Button_LatchInput(void)
+{
+    g_button_sample = Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX);
 }
 
 /*******************************************************************************************************************/
 void Button_RefreshState(void)
 {
-    uint8 state = Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX);
+    uint8 state = g_button_sample;
 
     /* Count the number of Pressed times increment if the switch pressed for 20 ms */
     static uint8 g_Pressed_Count  = 0;
@@ -47,13 +80,13 @@ void Button_RefreshState(void)
 
     if(g_Pressed_Count == 3)
     {
-        g_button_state = BUTTON_PRESSED;
+        Button_SetState(BUTTON_PRESSED);
         g_Pressed_Count       = 0;
         g_Released_Count      = 0;
     }
     else if(g_Released_Count == 3)
     {
-        g_button_state = BUTTON_RELEASED;
+        Button_SetState(BUTTON_RELEASED);
         g_Released_Count      = 0;
         g_Pressed_Count       = 0;
     }
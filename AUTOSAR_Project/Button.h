@@ -14,9 +14,18 @@
 #include "Std_Types.h"
 #include "Button_Cfg.h"
 
-/* Description: Read the Button state Pressed/Released */
+/* Description: Notification of a state change, implemented by the application (BUTTON_EVENT_NOTIFICATION in Button_Cfg.h) */
+void App_ButtonNotification(void);
+
+/*
+ * Description: Read the Button state Pressed/Released. It takes the Os resource Button_State, so it
+ *              may only be called by the tasks using it: Button_Task and the jobs of Os_ServerTask.
+ */
 uint8 Button_GetState(void);
 
+/* Description: Read the switch level debounced by the next Button_RefreshState */
+void Button_LatchInput(void);
+
 /* 
  * Description: This function is called every 20ms by Os Task and it responsible for Updating 
  *              the BUTTON State. it should be in a PRESSED State if the button is pressed for 60ms.
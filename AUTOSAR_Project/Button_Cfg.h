@@ -16,5 +16,8 @@
 #define BUTTON_PRESSED  STD_LOW
 #define BUTTON_RELEASED STD_HIGH
 
+/* Function called by Button_RefreshState on every change of the state, once it is sent to the Button_Events queue */
+#define BUTTON_EVENT_NOTIFICATION   App_ButtonNotification
+
 
 #endif /* BUTTON_CFG_H_ */
@@ -11,6 +11,7 @@
 
 #include "Dio.h"
 #include "Dio_Regs.h"
+#include "SchM.h"
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
 
@@ -121,6 +122,8 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
             case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
 		               break;
 		}
+		/* The other channels of the port may be written by a preempting task */
+		SchM_Enter_Dio_DIO_EXCLUSIVE_AREA_0();
 		if(Level == STD_HIGH)
 		{
 			/* Write Logic High */
@@ -131,6 +134,7 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 			/* Write Logic Low */
 			CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
 		}
+		SchM_Exit_Dio_DIO_EXCLUSIVE_AREA_0();
 	}
 	else
 	{
@@ -321,6 +325,7 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 		               break;
 		}
 		/* Read the required channel and write the required level */
+		SchM_Enter_Dio_DIO_EXCLUSIVE_AREA_0();
 		if(GET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num) == STD_HIGH)
 		{
 			CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
@@ -331,6 +336,7 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 			SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
 			output = STD_HIGH;
 		}
+		SchM_Exit_Dio_DIO_EXCLUSIVE_AREA_0();
 	}
 	else
 	{
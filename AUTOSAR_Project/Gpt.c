@@ -4,61 +4,306 @@
  *
  * File Name: Gpt.c
  *
- * Description: Source file for TM4C123GH6PM Microcontroller - SysTick Timer Driver.
+ * Description: Source file for TM4C123GH6PM Microcontroller - Gpt Driver: the
+ *              channels on the general purpose and wide timers and the SysTick
+ *              timer of the Os.
  *
  * Author: Mohannad Sabry
  ******************************************************************************/
 
 #include "Gpt.h"
-#include "tm4c123gh6pm_registers.h"
+#include "Gpt_Regs.h"
+#include "SchM.h"
+#include "Mcu.h"
+#include "Irq.h"
 
-#define SYSTICK_PRIORITY_MASK  0x1FFFFFFF
-#define SYSTICK_INTERRUPT_PRIORITY  3
-#define SYSTICK_PRIORITY_BITS_POS   29
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+
+#include "Det.h"
+/* AUTOSAR Version checking between Det and Gpt Modules */
+#if ((DET_AR_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION)\
+ || (DET_AR_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION)\
+ || (DET_AR_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Det.h does not match the expected version"
+#endif
+
+#endif
+
+/* The channel interrupts update the channel states the APIs read in the exclusive area */
+#if (GPT_INTERRUPT_PRIORITY < SCHM_BASEPRI_LEVEL)
+  #error "GPT_INTERRUPT_PRIORITY must not be above SCHM_BASEPRI_LEVEL"
+#endif
+#if (GPT_SYSTICK_INTERRUPT_PRIORITY < SCHM_BASEPRI_LEVEL)
+  #error "GPT_SYSTICK_INTERRUPT_PRIORITY must not be above SCHM_BASEPRI_LEVEL"
+#endif
+
+/* Trace points of the SysTick ISR, empty unless OS_TRACE is enabled */
+#include "Os_Trace.h"
+
+/* SysTick Control Register bits */
+#define SYSTICK_CTRL_ENABLE_MASK    0x01
+#define SYSTICK_CTRL_INTEN_MASK     0x02
+#define SYSTICK_CTRL_CLK_SRC_MASK   0x04
+
+/* Interrupt Control and State Register bits to check/clear a pending SysTick interrupt */
+#define SYSTICK_PENDSTSET_MASK      0x04000000
+#define SYSTICK_PENDSTCLR_MASK      0x02000000
+
+/* The SysTick counter is 24-bit wide */
+#define SYSTICK_MAX_RELOAD_VALUE    0x00FFFFFF
+
+/* The tick time is given in microseconds */
+#define SYSTICK_US_PER_SECOND       1000000U
 
 /* Global pointer to function used to point upper layer functions
  * to be used in Call Back */
 static void (*g_SysTick_Call_Back_Ptr)(void) = NULL_PTR;
 
+/*
+ * A tick lasts Tick_Time_Us * clock / 10^6 cycles, which is rarely a whole number and can be
+ * longer than the 24-bit counter. It is counted as g_SysTick_Periods_Per_Tick SysTick periods
+ * of g_SysTick_Period_Base cycles, one cycle longer every time the accumulated fractions
+ * g_SysTick_Fraction_Num / g_SysTick_Fraction_Den add up to one, so the ticks do not drift.
+ */
+static uint32 g_SysTick_Tick_Cycles       = 0;
+static uint32 g_SysTick_Periods_Per_Tick  = 1;
+static uint32 g_SysTick_Period_Base       = 0;
+static uint64 g_SysTick_Fraction_Num      = 0;
+static uint64 g_SysTick_Fraction_Den      = 1;
+static uint64 g_SysTick_Fraction_Acc      = 0;
+
+/* Length of the period being counted and of the following one already in the reload register */
+static uint32 g_SysTick_Period      = 0;
+static uint32 g_SysTick_Next_Period = 0;
+
+/* Periods of the current tick already counted and their cycles */
+static uint32 g_SysTick_Period_Count  = 0;
+static uint32 g_SysTick_Tick_Elapsed  = 0;
+
+/* Number of ticks, length in cycles, first tick boundary and fraction accumulator of the current tickless period */
+static uint32 g_SysTick_Suppressed_Ticks  = 0;
+static uint32 g_SysTick_Suppressed_Reload = 0;
+static uint32 g_SysTick_Suppressed_First  = 0;
+static uint64 g_SysTick_Suppressed_Acc    = 0;
+
+#if (GPT_SYSTICK_LATENCY_MEASUREMENT == STD_ON)
+/* First bucket of the jitter histogram covers 0 .. 2^4 - 1 cycles */
+#define SYSTICK_JITTER_FIRST_BIT    4U
+
+/* Measured interrupt timing, only written by the ISR */
+static SysTick_LatencyType g_SysTick_Latency;
+
+/* Latency of the last activation, the jitter is its change from one activation to the next */
+static uint32  g_SysTick_Last_Activation_Latency = 0;
+static boolean g_SysTick_Last_Activation_Valid   = FALSE;
+#endif
+
+static uint32 SysTick_NextPeriod(void);
+static uint32 SysTick_PeriodsCycles(uint32 Count);
+static void SysTick_SkipPeriods(uint32 Count);
+#if (GPT_SYSTICK_LATENCY_MEASUREMENT == STD_ON)
+static void SysTick_RecordActivation(uint32 Latency, uint32 Callback_Cycles);
+#endif
+
+/*********************************************************************************************/
+static uint32 SysTick_NextPeriod(void)
+{
+    /* The whole cycles, plus one each time the fractions add up to a cycle */
+    g_SysTick_Fraction_Acc += g_SysTick_Fraction_Num;
+    if(g_SysTick_Fraction_Acc >= g_SysTick_Fraction_Den)
+    {
+        g_SysTick_Fraction_Acc -= g_SysTick_Fraction_Den;
+        return g_SysTick_Period_Base + 1;
+    }
+    return g_SysTick_Period_Base;
+}
+
+/*********************************************************************************************/
+static uint32 SysTick_PeriodsCycles(uint32 Count)
+{
+    /* Total length of the next Count periods, without moving the fraction accumulator */
+    return (Count * g_SysTick_Period_Base)
+           + (uint32)((g_SysTick_Fraction_Acc + ((uint64)Count * g_SysTick_Fraction_Num)) / g_SysTick_Fraction_Den);
+}
+
+/*********************************************************************************************/
+static void SysTick_SkipPeriods(uint32 Count)
+{
+    g_SysTick_Fraction_Acc = (g_SysTick_Fraction_Acc + ((uint64)Count * g_SysTick_Fraction_Num)) % g_SysTick_Fraction_Den;
+}
+
+#if (GPT_SYSTICK_LATENCY_MEASUREMENT == STD_ON)
+/*********************************************************************************************/
+static void SysTick_RecordActivation(uint32 Latency, uint32 Callback_Cycles)
+{
+    sint32 Jitter;
+    uint32 Magnitude;
+    uint32 Bucket = 0;
+
+    g_SysTick_Latency.Activations++;
+    if(Callback_Cycles < g_SysTick_Latency.CallbackMin)
+    {
+        g_SysTick_Latency.CallbackMin = Callback_Cycles;
+    }
+    if(Callback_Cycles > g_SysTick_Latency.CallbackMax)
+    {
+        g_SysTick_Latency.CallbackMax = Callback_Cycles;
+    }
+
+    /* The tick boundaries are exact, so the change of the latency is the deviation of the
+     * time between the two activations from the tick time */
+    if(g_SysTick_Last_Activation_Valid)
+    {
+        Jitter = (sint32)(Latency - g_SysTick_Last_Activation_Latency);
+        if(Jitter < g_SysTick_Latency.JitterMin)
+        {
+            g_SysTick_Latency.JitterMin = Jitter;
+        }
+        if(Jitter > g_SysTick_Latency.JitterMax)
+        {
+            g_SysTick_Latency.JitterMax = Jitter;
+        }
+        Magnitude = (Jitter < 0) ? (uint32)(-Jitter) : (uint32)Jitter;
+        Magnitude >>= SYSTICK_JITTER_FIRST_BIT;
+        while((Magnitude != 0) && (Bucket < (SYSTICK_JITTER_BUCKETS - 1U)))
+        {
+            Magnitude >>= 1;
+            Bucket++;
+        }
+        g_SysTick_Latency.JitterHistogram[Bucket]++;
+    }
+    g_SysTick_Last_Activation_Latency = Latency;
+    g_SysTick_Last_Activation_Valid   = TRUE;
+}
+#endif
+
 /************************************************************************************
 * Service Name: SysTick_Handler
 * Description: SysTick Timer ISR
 ************************************************************************************/
 void SysTick_Handler(void)
 {
-    /* Check if the SysTick_SetCallBack is already called */
-    if(g_SysTick_Call_Back_Ptr != NULL_PTR)
+#if (GPT_SYSTICK_LATENCY_MEASUREMENT == STD_ON)
+    /* Read first: the counter restarted with the next period when the tick expired, the
+     * cycles it counted since then are the entry latency. The pending bit is cleared on
+     * entry, set again only if the following period ended too. */
+    uint32  Entry_Current = GPT_SYSTICK_CURRENT_REG;
+    boolean Overrun = (GPT_INTCTRL_REG & SYSTICK_PENDSTSET_MASK) ? TRUE : FALSE;
+    uint32  Latency = g_SysTick_Next_Period - Entry_Current;
+    uint32  Callback_Start;
+#endif
+
+    OS_TRACE_ISR_ENTER(OS_TRACE_ISR_SYSTICK);
+
+#if (GPT_SYSTICK_LATENCY_MEASUREMENT == STD_ON)
+    if(Overrun)
+    {
+        g_SysTick_Latency.Overruns++;
+    }
+    else
     {
-        (*g_SysTick_Call_Back_Ptr)(); /* call the function in the scheduler using call-back concept */
+        g_SysTick_Latency.Count++;
+        if(Latency < g_SysTick_Latency.LatencyMin)
+        {
+            g_SysTick_Latency.LatencyMin = Latency;
+        }
+        if(Latency > g_SysTick_Latency.LatencyMax)
+        {
+            g_SysTick_Latency.LatencyMax = Latency;
+        }
+    }
+#endif
+
+    /* The counter already reloaded the next period, program the one after it */
+    g_SysTick_Tick_Elapsed += g_SysTick_Period;
+    g_SysTick_Period_Count++;
+    g_SysTick_Period       = g_SysTick_Next_Period;
+    g_SysTick_Next_Period  = SysTick_NextPeriod();
+    GPT_SYSTICK_RELOAD_REG = g_SysTick_Next_Period - 1;
+
+    /* Check if the SysTick_SetCallBack is already called and the tick is complete */
+    if(g_SysTick_Period_Count == g_SysTick_Periods_Per_Tick)
+    {
+        g_SysTick_Period_Count = 0;
+        g_SysTick_Tick_Elapsed = 0;
+        if(g_SysTick_Call_Back_Ptr != NULL_PTR)
+        {
+#if (GPT_SYSTICK_LATENCY_MEASUREMENT == STD_ON)
+            Callback_Start = SysTick_GetElapsedCycles();
+#endif
+            (*g_SysTick_Call_Back_Ptr)(); /* call the function in the scheduler using call-back concept */
+#if (GPT_SYSTICK_LATENCY_MEASUREMENT == STD_ON)
+            if(Overrun)
+            {
+                /* The tick grid is lost, the next jitter would be meaningless */
+                g_SysTick_Last_Activation_Valid = FALSE;
+            }
+            else
+            {
+                SysTick_RecordActivation(Latency, SysTick_GetElapsedCycles() - Callback_Start);
+            }
+#endif
+        }
     }
     /* No need to clear the trigger flag (COUNT) bit ... it cleared automatically by the HW */
+
+    OS_TRACE_ISR_EXIT(OS_TRACE_ISR_SYSTICK);
 }
 
 /************************************************************************************
 * Service Name: SysTick_Start
 * Sync/Async: Synchronous
 * Reentrancy: reentrant
-* Parameters (in): Tick_Time - Time in miliseconds
+* Parameters (in): Tick_Time_Us - Time in microseconds
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description: Function to Setup the SysTick Timer configuration to count n miliseconds:
-*              - Set the Reload value
-*              - Enable SysTick Timer with System clock 16Mhz
+* Description: Function to Setup the SysTick Timer configuration to count n microseconds:
+*              - Derive the tick length from the core clock given by the Mcu
+*              - Split it in periods that fit the 24-bit counter, with the fractional cycles
+*                spread over the periods so the tick has no long-term drift
+*              - Enable SysTick Timer with the System clock
 *              - Enable SysTick Timer Interrupt and set its priority
 ************************************************************************************/
-void SysTick_Start(uint16 Tick_Time)
+void SysTick_Start(uint32 Tick_Time_Us)
 {
-    SYSTICK_CTRL_REG    = 0;                         /* Disable the SysTick Timer by Clear the ENABLE Bit */
-    SYSTICK_RELOAD_REG  = 15999 * Tick_Time;         /* Set the Reload value to count n miliseconds */
-    SYSTICK_CURRENT_REG = 0;                         /* Clear the Current Register value */
+    /* Cycles of one tick, multiplied by 10^6 to keep the fraction */
+    uint64 Tick_Cycles_Scaled = (uint64)Mcu_GetCoreClockHz() * Tick_Time_Us;
+    uint64 Tick_Cycles = Tick_Cycles_Scaled / SYSTICK_US_PER_SECOND;
+
+    if(Tick_Cycles == 0)
+    {
+        return;
+    }
+
+    /* A period can be one cycle longer than the base, which must fit the counter */
+    g_SysTick_Tick_Cycles      = (uint32)Tick_Cycles;
+    g_SysTick_Periods_Per_Tick = (uint32)((Tick_Cycles + SYSTICK_MAX_RELOAD_VALUE - 1) / SYSTICK_MAX_RELOAD_VALUE);
+    g_SysTick_Fraction_Den     = (uint64)SYSTICK_US_PER_SECOND * g_SysTick_Periods_Per_Tick;
+    g_SysTick_Period_Base      = (uint32)(Tick_Cycles_Scaled / g_SysTick_Fraction_Den);
+    g_SysTick_Fraction_Num     = Tick_Cycles_Scaled % g_SysTick_Fraction_Den;
+    g_SysTick_Fraction_Acc     = 0;
+    g_SysTick_Period_Count     = 0;
+    g_SysTick_Tick_Elapsed     = 0;
+    g_SysTick_Period           = SysTick_NextPeriod();
+    g_SysTick_Next_Period      = SysTick_NextPeriod();
+
+#if (GPT_SYSTICK_LATENCY_MEASUREMENT == STD_ON)
+    SysTick_ResetLatencyStatistics();
+#endif
+
+    GPT_SYSTICK_CTRL_REG    = 0;                            /* Disable the SysTick Timer by Clear the ENABLE Bit */
+    GPT_SYSTICK_RELOAD_REG  = g_SysTick_Period - 1;         /* Set the Reload value of the first period */
+    GPT_SYSTICK_CURRENT_REG = 0;                            /* Clear the Current Register value */
     /* Configure the SysTick Control Register 
      * Enable the SysTick Timer (ENABLE = 1)
      * Enable SysTick Interrupt (INTEN = 1)
      * Choose the clock source to be System Clock (CLK_SRC = 1) */
-    SYSTICK_CTRL_REG   |= 0x07;
-    /* Assign priority level 3 to the SysTick Interrupt */
-    NVIC_SYSTEM_PRI3_REG =  (NVIC_SYSTEM_PRI3_REG & SYSTICK_PRIORITY_MASK) | (SYSTICK_INTERRUPT_PRIORITY << SYSTICK_PRIORITY_BITS_POS);
+    GPT_SYSTICK_CTRL_REG   |= 0x07;
+    /* The counter started with the first period, the new reload value is used after it */
+    GPT_SYSTICK_RELOAD_REG  = g_SysTick_Next_Period - 1;
+    /* Same level as in the Irq configuration table, the SysTick ISR shares the Gpt exclusive area */
+    (void)Irq_SetPriority(IRQ_VECTOR_SYSTICK, GPT_SYSTICK_INTERRUPT_PRIORITY);
 }
 
 /************************************************************************************
@@ -73,7 +318,7 @@ void SysTick_Start(uint16 Tick_Time)
 ************************************************************************************/
 void SysTick_Stop(void)
 {
-    SYSTICK_CTRL_REG = 0; /* Disable the SysTick Timer by Clear the ENABLE Bit */
+    GPT_SYSTICK_CTRL_REG = 0; /* Disable the SysTick Timer by Clear the ENABLE Bit */
 }
 
 /************************************************************************************
@@ -90,3 +335,1191 @@ void SysTick_SetCallBack(void(*Ptr2Func)(void))
 {
     g_SysTick_Call_Back_Ptr = Ptr2Func;
 }
+
+/************************************************************************************
+* Service Name: SysTick_GetMaxSuppressedTicks
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Maximum number of ticks that fit in one tickless period
+* Description: Function to get the longest tickless period the 24-bit SysTick counter
+*              can count with the tick time given to SysTick_Start. A tick counted in
+*              several SysTick periods can not be suppressed, the result is 1.
+************************************************************************************/
+uint32 SysTick_GetMaxSuppressedTicks(void)
+{
+    if(g_SysTick_Periods_Per_Tick > 1)
+    {
+        return 1;
+    }
+    return SYSTICK_MAX_RELOAD_VALUE / (g_SysTick_Period_Base + 1);
+}
+
+/************************************************************************************
+* Service Name: SysTick_GetTickCycles
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Number of clock cycles in one tick period
+* Description: Function to get the length of the tick period given to SysTick_Start in
+*              whole clock cycles, the ticks are one cycle longer from time to time to
+*              count the fraction of a cycle left out.
+************************************************************************************/
+uint32 SysTick_GetTickCycles(void)
+{
+    return g_SysTick_Tick_Cycles;
+}
+
+/************************************************************************************
+* Service Name: SysTick_GetElapsedCycles
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Number of clock cycles since the last tick served by the ISR
+* Description: Function to get the time elapsed in the current tick period. A tick that
+*              expired but whose interrupt is still pending is counted in the result, so
+*              it can exceed one tick period. Must be called with interrupts disabled and
+*              not during a tickless period.
+************************************************************************************/
+uint32 SysTick_GetElapsedCycles(void)
+{
+    /* The counter is loaded with the length of the period minus one on the first cycle and
+     * reaches 0 at its end, also during the shorter first period after a tickless period
+     * as it ends on the tick grid */
+    uint32 current = GPT_SYSTICK_CURRENT_REG;
+
+    if(GPT_INTCTRL_REG & SYSTICK_PENDSTSET_MASK)
+    {
+        /* The counter reached zero (maybe after the first read): the whole period elapsed,
+         * read it again to get the cycles of the next period. Zero is still the end of the
+         * expired period. */
+        current = GPT_SYSTICK_CURRENT_REG;
+        return g_SysTick_Tick_Elapsed + g_SysTick_Period
+               + ((current == 0) ? 0 : (g_SysTick_Next_Period - current));
+    }
+    return g_SysTick_Tick_Elapsed + (g_SysTick_Period - current);
+}
+
+#if (GPT_SYSTICK_LATENCY_MEASUREMENT == STD_ON)
+/************************************************************************************
+* Service Name: SysTick_GetLatencyStatistics
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Statistics - Latency, callback and jitter figures measured so far
+* Return value: Std_ReturnType - E_NOT_OK if Statistics is a null pointer
+* Description: Function to get the SysTick interrupt timing measured by the ISR.
+************************************************************************************/
+Std_ReturnType SysTick_GetLatencyStatistics(SysTick_LatencyType * Statistics)
+{
+    if(Statistics == NULL_PTR)
+    {
+        return E_NOT_OK;
+    }
+
+    /* Copy with the SysTick masked so the figures of one interrupt are consistent */
+    SchM_Enter_Gpt_GPT_EXCLUSIVE_AREA_0();
+    *Statistics = g_SysTick_Latency;
+    SchM_Exit_Gpt_GPT_EXCLUSIVE_AREA_0();
+
+    if(Statistics->Count == 0)
+    {
+        Statistics->LatencyMin = 0;
+    }
+    if(Statistics->Activations == 0)
+    {
+        Statistics->CallbackMin = 0;
+    }
+    if(Statistics->JitterMin > Statistics->JitterMax)
+    {
+        Statistics->JitterMin = 0;
+        Statistics->JitterMax = 0;
+    }
+    return E_OK;
+}
+
+/************************************************************************************
+* Service Name: SysTick_ResetLatencyStatistics
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to restart the SysTick interrupt timing measurement.
+************************************************************************************/
+void SysTick_ResetLatencyStatistics(void)
+{
+    uint8 Bucket;
+
+    SchM_Enter_Gpt_GPT_EXCLUSIVE_AREA_0();
+    g_SysTick_Latency.Count       = 0;
+    g_SysTick_Latency.LatencyMin  = 0xFFFFFFFF;
+    g_SysTick_Latency.LatencyMax  = 0;
+    g_SysTick_Latency.Overruns    = 0;
+    g_SysTick_Latency.Activations = 0;
+    g_SysTick_Latency.CallbackMin = 0xFFFFFFFF;
+    g_SysTick_Latency.CallbackMax = 0;
+    g_SysTick_Latency.JitterMin   = 0x7FFFFFFF;
+    g_SysTick_Latency.JitterMax   = -0x7FFFFFFF - 1;
+    for(Bucket = 0; Bucket < SYSTICK_JITTER_BUCKETS; Bucket++)
+    {
+        g_SysTick_Latency.JitterHistogram[Bucket] = 0;
+    }
+    g_SysTick_Last_Activation_Valid = FALSE;
+    SchM_Exit_Gpt_GPT_EXCLUSIVE_AREA_0();
+}
+#endif
+
+/************************************************************************************
+* Service Name: SysTick_SuppressTicks
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Ticks - Number of tick periods until the next interrupt (2 .. SysTick_GetMaxSuppressedTicks)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_NOT_OK if the current tick already expired or Ticks is out of range
+* Description: Function to start a tickless period. The next SysTick interrupt is moved
+*              to the end of the given number of ticks counted from the last tick, so the
+*              CPU can sleep until then. Must be called with interrupts disabled and
+*              must be followed by SysTick_ResumeTicks.
+************************************************************************************/
+Std_ReturnType SysTick_SuppressTicks(uint32 Ticks)
+{
+    if((Ticks < 2) || (Ticks > SysTick_GetMaxSuppressedTicks()))
+    {
+        return E_NOT_OK;
+    }
+
+    /* Stop the counter while it is reprogrammed (no read-modify-write, keep INTEN and CLK_SRC) */
+    GPT_SYSTICK_CTRL_REG = SYSTICK_CTRL_INTEN_MASK | SYSTICK_CTRL_CLK_SRC_MASK;
+
+    if(GPT_INTCTRL_REG & SYSTICK_PENDSTSET_MASK)
+    {
+        /* The current tick already expired, let its interrupt be served normally */
+        GPT_SYSTICK_CTRL_REG |= SYSTICK_CTRL_ENABLE_MASK;
+        return E_NOT_OK;
+    }
+
+    /* Cycles left until the next tick, the tick after it (already in the reload register) and
+     * the ticks after them. The fraction accumulator is kept to find the ticks on a wake-up. */
+    g_SysTick_Suppressed_Ticks  = Ticks;
+    g_SysTick_Suppressed_First  = GPT_SYSTICK_CURRENT_REG;
+    g_SysTick_Suppressed_Acc    = g_SysTick_Fraction_Acc;
+    g_SysTick_Suppressed_Reload = g_SysTick_Suppressed_First + g_SysTick_Next_Period + SysTick_PeriodsCycles(Ticks - 2);
+    SysTick_SkipPeriods(Ticks - 2);
+
+    GPT_SYSTICK_RELOAD_REG  = g_SysTick_Suppressed_Reload - 1;
+    GPT_SYSTICK_CURRENT_REG = 0;
+    GPT_SYSTICK_CTRL_REG   |= SYSTICK_CTRL_ENABLE_MASK;
+
+    return E_OK;
+}
+
+/************************************************************************************
+* Service Name: SysTick_ResumeTicks
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Number of whole tick periods elapsed during the tickless period
+* Description: Function to end a tickless period started by SysTick_SuppressTicks.
+*              The elapsed time is taken from the counter value, the interrupt of the
+*              wake-up tick is cleared (it is accounted in the returned value) and the
+*              periodic tick is restarted aligned to the original tick boundaries.
+*              Must be called with interrupts disabled.
+************************************************************************************/
+uint32 SysTick_ResumeTicks(void)
+{
+    uint32 elapsed_ticks;
+    uint32 elapsed_cycles;
+    uint32 tick_cycles;
+    uint32 next_cycles;
+    uint32 periods;
+    uint32 current;
+
+    /* Stop the counter to read a stable value */
+    GPT_SYSTICK_CTRL_REG = SYSTICK_CTRL_INTEN_MASK | SYSTICK_CTRL_CLK_SRC_MASK;
+    current = GPT_SYSTICK_CURRENT_REG;
+
+    if(GPT_INTCTRL_REG & SYSTICK_PENDSTSET_MASK)
+    {
+        /* Woken up by the SysTick: the whole period elapsed and the counter may have reloaded
+         * with the long value, the cycles counted since then belong to the next ticks */
+        GPT_INTCTRL_REG = SYSTICK_PENDSTCLR_MASK;
+        elapsed_ticks  = g_SysTick_Suppressed_Ticks;
+        elapsed_cycles = (current == 0) ? 0 : (g_SysTick_Suppressed_Reload - current);
+        tick_cycles    = SysTick_NextPeriod();
+        while(elapsed_cycles >= tick_cycles)
+        {
+            elapsed_cycles -= tick_cycles;
+            elapsed_ticks++;
+            tick_cycles = SysTick_NextPeriod();
+        }
+        next_cycles = SysTick_NextPeriod();
+    }
+    else
+    {
+        /* Woken up by another interrupt: find the last tick boundary passed, from the ones
+         * computed by SysTick_SuppressTicks */
+        elapsed_cycles = (current == 0) ? 0 : (g_SysTick_Suppressed_Reload - current);
+        g_SysTick_Fraction_Acc = g_SysTick_Suppressed_Acc;
+        if(elapsed_cycles < g_SysTick_Suppressed_First)
+        {
+            /* Still in the tick the tickless period started in, followed by the one
+             * already generated */
+            elapsed_ticks  = 0;
+            tick_cycles    = g_SysTick_Period;
+            next_cycles    = g_SysTick_Next_Period;
+            elapsed_cycles = (g_SysTick_Period - g_SysTick_Suppressed_First) + elapsed_cycles;
+        }
+        else
+        {
+            elapsed_cycles -= g_SysTick_Suppressed_First;
+            elapsed_ticks   = 1;
+            tick_cycles     = g_SysTick_Next_Period;
+            if(elapsed_cycles >= tick_cycles)
+            {
+                /* Whole ticks after that one: estimated from the mean tick length, then corrected */
+                elapsed_cycles -= tick_cycles;
+                periods = (uint32)(((uint64)elapsed_cycles * g_SysTick_Fraction_Den)
+                                   / (((uint64)g_SysTick_Period_Base * g_SysTick_Fraction_Den) + g_SysTick_Fraction_Num));
+                while(SysTick_PeriodsCycles(periods + 1) <= elapsed_cycles)
+                {
+                    periods++;
+                }
+                while((periods > 0) && (SysTick_PeriodsCycles(periods) > elapsed_cycles))
+                {
+                    periods--;
+                }
+                elapsed_cycles -= SysTick_PeriodsCycles(periods);
+                SysTick_SkipPeriods(periods);
+                elapsed_ticks += periods + 1;
+                tick_cycles = SysTick_NextPeriod();
+            }
+            next_cycles = SysTick_NextPeriod();
+        }
+    }
+
+    /* Count the rest of the current tick, then continue with the following periods. The
+     * elapsed cycles of the current tick are seen through its full length. */
+    g_SysTick_Period      = tick_cycles;
+    g_SysTick_Next_Period = next_cycles;
+    current = tick_cycles - elapsed_cycles;
+
+    /* The reload value must be at least 1 */
+    if(current < 2)
+    {
+        current = 2;
+    }
+
+    /* The new reload value is only used after the counter reaches zero */
+    GPT_SYSTICK_RELOAD_REG  = current - 1;
+    GPT_SYSTICK_CURRENT_REG = 0;
+    GPT_SYSTICK_CTRL_REG   |= SYSTICK_CTRL_ENABLE_MASK;
+    GPT_SYSTICK_RELOAD_REG  = g_SysTick_Next_Period - 1;
+
+    return elapsed_ticks;
+}
+
+/*******************************************************************************
+ *                      Gpt Channels                                           *
+ *******************************************************************************/
+
+/* Timer modules in Gpt_HwTimerType order and their sub-timers A and B */
+#define GPT_TIMER_COUNT                 (12U)
+#define GPT_SUBTIMER_COUNT              (24U)
+
+/* Sub-timer without a channel */
+#define GPT_NO_CHANNEL                  (0xFFU)
+
+/* GPTMCFG: the halves run as two independent timers or concatenated */
+#define GPT_CFG_INDIVIDUAL              0x04
+#define GPT_CFG_CONCATENATED            0x00
+
+/* GPTMTnMR: one-shot or periodic mode, counting down */
+#define GPT_TNMR_ONE_SHOT               0x01
+#define GPT_TNMR_PERIODIC               0x02
+
+/* GPTMCTL TnEN and GPTMIMR/RIS/ICR TnTOIM bits of timer A, the timer B bits are 8 positions higher */
+#define GPT_TAEN_MASK                   0x01
+#define GPT_TATOIM_MASK                 0x01
+#define GPT_TIMER_B_BIT_SHIFT           8
+
+/* Largest prescaler of a timer half and of a wide timer half */
+#define GPT_TIMER_MAX_PRESCALE          0xFF
+#define GPT_WIDE_TIMER_MAX_PRESCALE     0xFFFF
+
+/* States of a channel */
+#define GPT_CHANNEL_INITIALIZED         (0U)
+#define GPT_CHANNEL_RUNNING             (1U)
+#define GPT_CHANNEL_STOPPED             (2U)
+#define GPT_CHANNEL_EXPIRED             (3U)
+
+/* Description: Structure to hold the run-time state of one channel */
+typedef struct
+{
+    /* Timeout value given to Gpt_StartTimer */
+    Gpt_ValueType Target;
+    /* Time elapsed when the channel was stopped */
+    Gpt_ValueType Stop_Elapsed;
+    uint8 State;
+    boolean Notification_Enabled;
+} Gpt_ChannelStateType;
+
+STATIC const Gpt_ConfigChannel * Gpt_Channels = NULL_PTR;
+STATIC uint8 Gpt_Status = GPT_NOT_INITIALIZED;
+STATIC Gpt_ChannelStateType Gpt_Channel_State[GPT_CONFIGURED_CHANNELS];
+
+/* Channel served by the interrupt of every sub-timer, GPT_NO_CHANNEL if none */
+STATIC uint8 Gpt_SubTimer_Channel[GPT_SUBTIMER_COUNT];
+
+/* Register blocks of the timer modules in Gpt_HwTimerType order */
+static volatile uint8 * const Gpt_Timer_Base[GPT_TIMER_COUNT] = {
+                                                                    GPT_TIMER0_BASE_ADDRESS,  GPT_TIMER1_BASE_ADDRESS,
+                                                                    GPT_TIMER2_BASE_ADDRESS,  GPT_TIMER3_BASE_ADDRESS,
+                                                                    GPT_TIMER4_BASE_ADDRESS,  GPT_TIMER5_BASE_ADDRESS,
+                                                                    GPT_WTIMER0_BASE_ADDRESS, GPT_WTIMER1_BASE_ADDRESS,
+                                                                    GPT_WTIMER2_BASE_ADDRESS, GPT_WTIMER3_BASE_ADDRESS,
+                                                                    GPT_WTIMER4_BASE_ADDRESS, GPT_WTIMER5_BASE_ADDRESS
+                                                                };
+
+/* IRQ numbers of the sub-timers, timer A then timer B of every module */
+static const uint8 Gpt_SubTimer_Irq[GPT_SUBTIMER_COUNT] = {
+                                                              19, 20, 21, 22, 23, 24, 35, 36, 70, 71, 92, 93,
+                                                              94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105
+                                                          };
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+static boolean Gpt_CheckChannel(Gpt_ChannelType Channel, uint8 ServiceId);
+static Std_ReturnType Gpt_CheckConfig(const Gpt_ConfigType * ConfigPtr);
+#endif
+static uint8 Gpt_SubTimerIndex(const Gpt_ConfigChannel * Channel);
+static uint32 Gpt_SubTimerMask(const Gpt_ConfigChannel * Channel, uint32 Mask);
+static uint32 Gpt_SubTimerStep(const Gpt_ConfigChannel * Channel);
+static Gpt_ValueType Gpt_MaxValue(const Gpt_ConfigChannel * Channel);
+static void Gpt_EnableClock(Gpt_HwTimerType Timer);
+static void Gpt_LoadCounter(const Gpt_ConfigChannel * Channel, Gpt_ValueType Load);
+static Gpt_ValueType Gpt_ReadCounter(const Gpt_ConfigChannel * Channel);
+static boolean Gpt_TimedOut(const Gpt_ConfigChannel * Channel);
+static Gpt_ValueType Gpt_ChannelElapsed(Gpt_ChannelType Channel);
+static void Gpt_SubTimerHandler(uint8 SubTimer);
+static void Gpt_Timer0A_Handler(void);
+static void Gpt_Timer0B_Handler(void);
+static void Gpt_Timer1A_Handler(void);
+static void Gpt_Timer1B_Handler(void);
+static void Gpt_Timer2A_Handler(void);
+static void Gpt_Timer2B_Handler(void);
+static void Gpt_Timer3A_Handler(void);
+static void Gpt_Timer3B_Handler(void);
+static void Gpt_Timer4A_Handler(void);
+static void Gpt_Timer4B_Handler(void);
+static void Gpt_Timer5A_Handler(void);
+static void Gpt_Timer5B_Handler(void);
+static void Gpt_WideTimer0A_Handler(void);
+static void Gpt_WideTimer0B_Handler(void);
+static void Gpt_WideTimer1A_Handler(void);
+static void Gpt_WideTimer1B_Handler(void);
+static void Gpt_WideTimer2A_Handler(void);
+static void Gpt_WideTimer2B_Handler(void);
+static void Gpt_WideTimer3A_Handler(void);
+static void Gpt_WideTimer3B_Handler(void);
+static void Gpt_WideTimer4A_Handler(void);
+static void Gpt_WideTimer4B_Handler(void);
+#if (GPT_WIDE_TIMER_5_RESERVED == STD_OFF)
+static void Gpt_WideTimer5A_Handler(void);
+static void Gpt_WideTimer5B_Handler(void);
+#endif
+
+/* ISRs of the sub-timers installed by Gpt_Init, timer A then timer B of every module */
+static const Irq_HandlerType Gpt_SubTimer_Handler[GPT_SUBTIMER_COUNT] = {
+    Gpt_Timer0A_Handler,     Gpt_Timer0B_Handler,     Gpt_Timer1A_Handler,     Gpt_Timer1B_Handler,
+    Gpt_Timer2A_Handler,     Gpt_Timer2B_Handler,     Gpt_Timer3A_Handler,     Gpt_Timer3B_Handler,
+    Gpt_Timer4A_Handler,     Gpt_Timer4B_Handler,     Gpt_Timer5A_Handler,     Gpt_Timer5B_Handler,
+    Gpt_WideTimer0A_Handler, Gpt_WideTimer0B_Handler, Gpt_WideTimer1A_Handler, Gpt_WideTimer1B_Handler,
+    Gpt_WideTimer2A_Handler, Gpt_WideTimer2B_Handler, Gpt_WideTimer3A_Handler, Gpt_WideTimer3B_Handler,
+    Gpt_WideTimer4A_Handler, Gpt_WideTimer4B_Handler,
+#if (GPT_WIDE_TIMER_5_RESERVED == STD_OFF)
+    Gpt_WideTimer5A_Handler, Gpt_WideTimer5B_Handler
+#else
+    NULL_PTR,                NULL_PTR
+#endif
+};
+
+/*******************************************************************************************************************/
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+static boolean Gpt_CheckChannel(Gpt_ChannelType Channel, uint8 ServiceId)
+{
+	boolean error = FALSE;
+
+	/* Check if the Driver is initialized before using this function */
+	if (GPT_NOT_INITIALIZED == Gpt_Status)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, ServiceId, GPT_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if the used channel is within the valid range */
+	else if (GPT_CONFIGURED_CHANNELS <= Channel)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, ServiceId, GPT_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return error;
+}
+
+/*******************************************************************************************************************/
+static Std_ReturnType Gpt_CheckConfig(const Gpt_ConfigType * ConfigPtr)
+{
+	/* Halves of every timer module already used: bit 0 for A, bit 1 for B */
+	uint8 Used_Halves[GPT_TIMER_COUNT] = {0};
+	const Gpt_ConfigChannel * Channel;
+	Gpt_ChannelType ChannelId;
+	uint8 Halves;
+
+	for (ChannelId = 0; ChannelId < GPT_CONFIGURED_CHANNELS; ChannelId++)
+	{
+		Channel = &ConfigPtr->Channels[ChannelId];
+		if ((Channel->Timer > GPT_WIDE_TIMER_5) || (Channel->SubTimer > GPT_SUBTIMER_CONCATENATED)
+		    || (Channel->Mode > GPT_CH_MODE_ONESHOT))
+		{
+			return E_NOT_OK;
+		}
+#if (GPT_WIDE_TIMER_5_RESERVED == STD_ON)
+		if (GPT_WIDE_TIMER_5 == Channel->Timer)
+		{
+			return E_NOT_OK;
+		}
+#endif
+		if (GPT_SUBTIMER_CONCATENATED == Channel->SubTimer)
+		{
+			/* The prescaler only extends the halves, a concatenated timer counts every clock cycle */
+			if (0 != Channel->Prescale)
+			{
+				return E_NOT_OK;
+			}
+#if (GPT_64BIT_VALUE_SUPPORT == STD_OFF)
+			if (Channel->Timer >= GPT_WIDE_TIMER_0)
+			{
+				return E_NOT_OK;
+			}
+#endif
+			Halves = 0x03;
+		}
+		else
+		{
+			if (Channel->Prescale > ((Channel->Timer >= GPT_WIDE_TIMER_0) ? GPT_WIDE_TIMER_MAX_PRESCALE : GPT_TIMER_MAX_PRESCALE))
+			{
+				return E_NOT_OK;
+			}
+			Halves = (GPT_SUBTIMER_A == Channel->SubTimer) ? 0x01 : 0x02;
+		}
+		/* Every half serves one channel */
+		if (Used_Halves[Channel->Timer] & Halves)
+		{
+			return E_NOT_OK;
+		}
+		Used_Halves[Channel->Timer] |= Halves;
+	}
+	return E_OK;
+}
+#endif
+
+/*******************************************************************************************************************/
+static uint8 Gpt_SubTimerIndex(const Gpt_ConfigChannel * Channel)
+{
+	/* The concatenated halves are controlled and interrupt as timer A */
+	return (uint8)((Channel->Timer * 2U) + ((GPT_SUBTIMER_B == Channel->SubTimer) ? 1U : 0U));
+}
+
+/*******************************************************************************************************************/
+static uint32 Gpt_SubTimerMask(const Gpt_ConfigChannel * Channel, uint32 Mask)
+{
+	return (GPT_SUBTIMER_B == Channel->SubTimer) ? (Mask << GPT_TIMER_B_BIT_SHIFT) : Mask;
+}
+
+/*******************************************************************************************************************/
+static uint32 Gpt_SubTimerStep(const Gpt_ConfigChannel * Channel)
+{
+	return (GPT_SUBTIMER_B == Channel->SubTimer) ? GPT_TIMER_B_REG_STEP : 0;
+}
+
+/*******************************************************************************************************************/
+static Gpt_ValueType Gpt_MaxValue(const Gpt_ConfigChannel * Channel)
+{
+	if (GPT_SUBTIMER_CONCATENATED == Channel->SubTimer)
+	{
+#if (GPT_64BIT_VALUE_SUPPORT == STD_ON)
+		if (Channel->Timer >= GPT_WIDE_TIMER_0)
+		{
+			return ~((Gpt_ValueType)0);
+		}
+#endif
+		return 0xFFFFFFFF;
+	}
+	return (Channel->Timer >= GPT_WIDE_TIMER_0) ? 0xFFFFFFFF : 0xFFFF;
+}
+
+/*******************************************************************************************************************/
+static void Gpt_EnableClock(Gpt_HwTimerType Timer)
+{
+	uint32 Rcgc_Offset = GPT_RCGCTIMER_REG_OFFSET;
+	uint32 Pr_Offset   = GPT_PRTIMER_REG_OFFSET;
+	uint32 Mask;
+
+	if (Timer >= GPT_WIDE_TIMER_0)
+	{
+		Rcgc_Offset = GPT_RCGCWTIMER_REG_OFFSET;
+		Pr_Offset   = GPT_PRWTIMER_REG_OFFSET;
+		Mask = (uint32)1 << (Timer - GPT_WIDE_TIMER_0);
+	}
+	else
+	{
+		Mask = (uint32)1 << Timer;
+	}
+
+	/* Enable the clock of the timer module and wait until it is ready */
+	GPT_REG(GPT_SYSCTL_BASE_ADDRESS, Rcgc_Offset) |= Mask;
+	while ((GPT_REG(GPT_SYSCTL_BASE_ADDRESS, Pr_Offset) & Mask) == 0)
+	{
+	}
+}
+
+/*******************************************************************************************************************/
+static void Gpt_LoadCounter(const Gpt_ConfigChannel * Channel, Gpt_ValueType Load)
+{
+	volatile uint8 * Base = Gpt_Timer_Base[Channel->Timer];
+	uint32 Step = Gpt_SubTimerStep(Channel);
+
+	/* The timer is disabled: the counter takes the new value right away, not at the next timeout */
+#if (GPT_64BIT_VALUE_SUPPORT == STD_ON)
+	if ((GPT_SUBTIMER_CONCATENATED == Channel->SubTimer) && (Channel->Timer >= GPT_WIDE_TIMER_0))
+	{
+		/* 64-bit: timer A holds the lower and timer B the upper 32 bits */
+		GPT_REG(Base, GPT_TBILR_REG_OFFSET) = (uint32)(Load >> 32);
+		GPT_REG(Base, GPT_TAILR_REG_OFFSET) = (uint32)Load;
+		GPT_REG(Base, GPT_TBV_REG_OFFSET)   = (uint32)(Load >> 32);
+		GPT_REG(Base, GPT_TAV_REG_OFFSET)   = (uint32)Load;
+		return;
+	}
+#endif
+	GPT_REG(Base, GPT_TAILR_REG_OFFSET + Step) = (uint32)Load;
+	GPT_REG(Base, GPT_TAV_REG_OFFSET + Step)   = (uint32)Load;
+}
+
+/*******************************************************************************************************************/
+static Gpt_ValueType Gpt_ReadCounter(const Gpt_ConfigChannel * Channel)
+{
+	volatile uint8 * Base = Gpt_Timer_Base[Channel->Timer];
+	uint32 Value;
+#if (GPT_64BIT_VALUE_SUPPORT == STD_ON)
+	uint32 High;
+
+	if ((GPT_SUBTIMER_CONCATENATED == Channel->SubTimer) && (Channel->Timer >= GPT_WIDE_TIMER_0))
+	{
+		/* Read the upper half again until the lower half did not wrap between the reads */
+		do
+		{
+			High  = GPT_REG(Base, GPT_TBV_REG_OFFSET);
+			Value = GPT_REG(Base, GPT_TAV_REG_OFFSET);
+		} while (High != GPT_REG(Base, GPT_TBV_REG_OFFSET));
+		return ((Gpt_ValueType)High << 32) | Value;
+	}
+#endif
+	Value = GPT_REG(Base, GPT_TAV_REG_OFFSET + Gpt_SubTimerStep(Channel));
+	if ((GPT_SUBTIMER_CONCATENATED != Channel->SubTimer) && (Channel->Timer < GPT_WIDE_TIMER_0))
+	{
+		/* The upper bits of a 16-bit half hold the prescaler count */
+		Value &= 0xFFFF;
+	}
+	return Value;
+}
+
+/*******************************************************************************************************************/
+static boolean Gpt_TimedOut(const Gpt_ConfigChannel * Channel)
+{
+	return (GPT_REG(Gpt_Timer_Base[Channel->Timer], GPT_RIS_REG_OFFSET)
+	        & Gpt_SubTimerMask(Channel, GPT_TATOIM_MASK)) ? TRUE : FALSE;
+}
+
+/*******************************************************************************************************************/
+static Gpt_ValueType Gpt_ChannelElapsed(Gpt_ChannelType Channel)
+{
+	const Gpt_ConfigChannel * Config = &Gpt_Channels[Channel];
+	Gpt_ChannelStateType * State = &Gpt_Channel_State[Channel];
+	Gpt_ValueType Counter;
+
+	switch (State->State)
+	{
+		case GPT_CHANNEL_RUNNING:
+			/* The counter is read before the timeout flag: a one-shot channel expiring in between is
+			 * seen expired, not restarted */
+			Counter = Gpt_ReadCounter(Config);
+			if ((GPT_CH_MODE_ONESHOT == Config->Mode) && Gpt_TimedOut(Config))
+			{
+				/* Expired, its interrupt is still pending */
+				return State->Target;
+			}
+			/* Counting down from Target - 1 to 0 */
+			return (State->Target - 1U) - Counter;
+		case GPT_CHANNEL_STOPPED:
+			return State->Stop_Elapsed;
+		case GPT_CHANNEL_EXPIRED:
+			return State->Target;
+		default:
+			return 0;
+	}
+}
+
+/*******************************************************************************************************************/
+static void Gpt_SubTimerHandler(uint8 SubTimer)
+{
+	uint8 ChannelId = Gpt_SubTimer_Channel[SubTimer];
+	const Gpt_ConfigChannel * Channel;
+
+	OS_TRACE_ISR_ENTER(OS_TRACE_ISR_GPT);
+
+	/* Clear the timeout flag of the sub-timer */
+	GPT_REG(Gpt_Timer_Base[SubTimer / 2U], GPT_ICR_REG_OFFSET) =
+	    (SubTimer & 1U) ? (GPT_TATOIM_MASK << GPT_TIMER_B_BIT_SHIFT) : GPT_TATOIM_MASK;
+
+	if ((GPT_INITIALIZED == Gpt_Status) && (GPT_NO_CHANNEL != ChannelId))
+	{
+		Channel = &Gpt_Channels[ChannelId];
+		if (GPT_CH_MODE_ONESHOT == Channel->Mode)
+		{
+			/* The hardware already stopped the timer */
+			Gpt_Channel_State[ChannelId].State = GPT_CHANNEL_EXPIRED;
+		}
+		if ((TRUE == Gpt_Channel_State[ChannelId].Notification_Enabled) && (NULL_PTR != Channel->Notification))
+		{
+			Channel->Notification();
+		}
+	}
+
+	OS_TRACE_ISR_EXIT(OS_TRACE_ISR_GPT);
+}
+
+/************************************************************************************
+* Service Name: Gpt_TimerXY_Handler
+* Description: Timer ISRs, every sub-timer interrupt serves the channel configured on it.
+*              Gpt_Init installs the ones of the configured channels in the vector table.
+*              The vector of Wide Timer 5A is Os_ProtectionTimerHandler.
+************************************************************************************/
+#define GPT_SUBTIMER_ISR(Name, SubTimer)    static void Name(void) { Gpt_SubTimerHandler(SubTimer); }
+
+GPT_SUBTIMER_ISR(Gpt_Timer0A_Handler, 0U)
+GPT_SUBTIMER_ISR(Gpt_Timer0B_Handler, 1U)
+GPT_SUBTIMER_ISR(Gpt_Timer1A_Handler, 2U)
+GPT_SUBTIMER_ISR(Gpt_Timer1B_Handler, 3U)
+GPT_SUBTIMER_ISR(Gpt_Timer2A_Handler, 4U)
+GPT_SUBTIMER_ISR(Gpt_Timer2B_Handler, 5U)
+GPT_SUBTIMER_ISR(Gpt_Timer3A_Handler, 6U)
+GPT_SUBTIMER_ISR(Gpt_Timer3B_Handler, 7U)
+GPT_SUBTIMER_ISR(Gpt_Timer4A_Handler, 8U)
+GPT_SUBTIMER_ISR(Gpt_Timer4B_Handler, 9U)
+GPT_SUBTIMER_ISR(Gpt_Timer5A_Handler, 10U)
+GPT_SUBTIMER_ISR(Gpt_Timer5B_Handler, 11U)
+GPT_SUBTIMER_ISR(Gpt_WideTimer0A_Handler, 12U)
+GPT_SUBTIMER_ISR(Gpt_WideTimer0B_Handler, 13U)
+GPT_SUBTIMER_ISR(Gpt_WideTimer1A_Handler, 14U)
+GPT_SUBTIMER_ISR(Gpt_WideTimer1B_Handler, 15U)
+GPT_SUBTIMER_ISR(Gpt_WideTimer2A_Handler, 16U)
+GPT_SUBTIMER_ISR(Gpt_WideTimer2B_Handler, 17U)
+GPT_SUBTIMER_ISR(Gpt_WideTimer3A_Handler, 18U)
+GPT_SUBTIMER_ISR(Gpt_WideTimer3B_Handler, 19U)
+GPT_SUBTIMER_ISR(Gpt_WideTimer4A_Handler, 20U)
+GPT_SUBTIMER_ISR(Gpt_WideTimer4B_Handler, 21U)
+#if (GPT_WIDE_TIMER_5_RESERVED == STD_OFF)
+GPT_SUBTIMER_ISR(Gpt_WideTimer5A_Handler, 22U)
+GPT_SUBTIMER_ISR(Gpt_WideTimer5B_Handler, 23U)
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_Init
+* Service ID[hex]: 0x01
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to post-build configuration data
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Initialize the Gpt module: clocks, modes and interrupts of the
+*              configured timers. The channels are stopped with their notifications disabled.
+************************************************************************************/
+void Gpt_Init(const Gpt_ConfigType * ConfigPtr)
+{
+	boolean error = FALSE;
+	const Gpt_ConfigChannel * Channel;
+	volatile uint8 * Base;
+	Gpt_ChannelType ChannelId;
+	uint8 SubTimer;
+	uint8 Irq;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	if (GPT_INITIALIZED == Gpt_Status)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_INIT_SID, GPT_E_ALREADY_INITIALIZED);
+		error = TRUE;
+	}
+	/* check if the input configuration pointer is not a NULL_PTR */
+	else if (NULL_PTR == ConfigPtr)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_INIT_SID, GPT_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	else if (E_OK != Gpt_CheckConfig(ConfigPtr))
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_INIT_SID, GPT_E_PARAM_CONFIG);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if (FALSE == error)
+	{
+		for (SubTimer = 0; SubTimer < GPT_SUBTIMER_COUNT; SubTimer++)
+		{
+			Gpt_SubTimer_Channel[SubTimer] = GPT_NO_CHANNEL;
+		}
+
+		for (ChannelId = 0; ChannelId < GPT_CONFIGURED_CHANNELS; ChannelId++)
+		{
+			Channel  = &ConfigPtr->Channels[ChannelId];
+			Base     = Gpt_Timer_Base[Channel->Timer];
+			SubTimer = Gpt_SubTimerIndex(Channel);
+			Irq      = Gpt_SubTimer_Irq[SubTimer];
+
+			Gpt_EnableClock(Channel->Timer);
+
+			/* Timer disabled while it is configured, the other half may serve another channel */
+			GPT_REG(Base, GPT_CTL_REG_OFFSET) &= ~Gpt_SubTimerMask(Channel, GPT_TAEN_MASK);
+			GPT_REG(Base, GPT_CFG_REG_OFFSET)  = (GPT_SUBTIMER_CONCATENATED == Channel->SubTimer) ?
+			                                     GPT_CFG_CONCATENATED : GPT_CFG_INDIVIDUAL;
+			GPT_REG(Base, GPT_TAMR_REG_OFFSET + Gpt_SubTimerStep(Channel)) =
+			    (GPT_CH_MODE_ONESHOT == Channel->Mode) ? GPT_TNMR_ONE_SHOT : GPT_TNMR_PERIODIC;
+			if (GPT_SUBTIMER_CONCATENATED != Channel->SubTimer)
+			{
+				/* Counting down the prescaler divides the clock of the half */
+				GPT_REG(Base, GPT_TAPR_REG_OFFSET + Gpt_SubTimerStep(Channel)) = Channel->Prescale;
+			}
+
+			/* Timeout interrupt of the sub-timer */
+			GPT_REG(Base, GPT_ICR_REG_OFFSET)  = Gpt_SubTimerMask(Channel, GPT_TATOIM_MASK);
+			GPT_REG(Base, GPT_IMR_REG_OFFSET) |= Gpt_SubTimerMask(Channel, GPT_TATOIM_MASK);
+			(void)Irq_Register(IRQ_VECTOR(Irq), Gpt_SubTimer_Handler[SubTimer], GPT_INTERRUPT_PRIORITY);
+			Irq_EnableInterrupt(IRQ_VECTOR(Irq));
+
+			Gpt_Channel_State[ChannelId].Target               = 0;
+			Gpt_Channel_State[ChannelId].Stop_Elapsed         = 0;
+			Gpt_Channel_State[ChannelId].State                = GPT_CHANNEL_INITIALIZED;
+			Gpt_Channel_State[ChannelId].Notification_Enabled = FALSE;
+			Gpt_SubTimer_Channel[SubTimer] = ChannelId;
+		}
+
+		/*
+		 * Set the module state to initialized and point to the PB configuration structure using a global pointer.
+		 * This global pointer is global to be used by other functions to read the PB configuration structures
+		 */
+		Gpt_Channels = ConfigPtr->Channels;
+		Gpt_Status   = GPT_INITIALIZED;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Gpt_DeInit
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to De-Initialize the Gpt module: the timers and their interrupts of
+*              the configured channels are disabled. No channel may be running.
+************************************************************************************/
+#if (GPT_DEINIT_API == STD_ON)
+void Gpt_DeInit(void)
+{
+	boolean error = FALSE;
+	const Gpt_ConfigChannel * Channel;
+	volatile uint8 * Base;
+	Gpt_ChannelType ChannelId;
+	uint8 SubTimer;
+	uint8 Irq;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	if (GPT_NOT_INITIALIZED == Gpt_Status)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_DEINIT_SID, GPT_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		for (ChannelId = 0; ChannelId < GPT_CONFIGURED_CHANNELS; ChannelId++)
+		{
+			if (GPT_CHANNEL_RUNNING == Gpt_Channel_State[ChannelId].State)
+			{
+				Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_DEINIT_SID, GPT_E_BUSY);
+				error = TRUE;
+				break;
+			}
+		}
+	}
+#endif
+
+	/* In-case there are no errors */
+	if (FALSE == error)
+	{
+		for (ChannelId = 0; ChannelId < GPT_CONFIGURED_CHANNELS; ChannelId++)
+		{
+			Channel  = &Gpt_Channels[ChannelId];
+			Base     = Gpt_Timer_Base[Channel->Timer];
+			SubTimer = Gpt_SubTimerIndex(Channel);
+			Irq      = Gpt_SubTimer_Irq[SubTimer];
+
+			Irq_DisableInterrupt(IRQ_VECTOR(Irq));
+			GPT_REG(Base, GPT_CTL_REG_OFFSET) &= ~Gpt_SubTimerMask(Channel, GPT_TAEN_MASK);
+			GPT_REG(Base, GPT_IMR_REG_OFFSET) &= ~Gpt_SubTimerMask(Channel, GPT_TATOIM_MASK);
+			GPT_REG(Base, GPT_ICR_REG_OFFSET)  = Gpt_SubTimerMask(Channel, GPT_TATOIM_MASK);
+			Irq_ClearPending(IRQ_VECTOR(Irq));
+			Irq_Unregister(IRQ_VECTOR(Irq));
+			Gpt_SubTimer_Channel[SubTimer] = GPT_NO_CHANNEL;
+		}
+
+		Gpt_Status   = GPT_NOT_INITIALIZED;
+		Gpt_Channels = NULL_PTR;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_GetTimeElapsed
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpt_ValueType - Elapsed timer value (in number of ticks)
+* Description: Function to get the time elapsed since the channel was started, or since its
+*              last timeout in continuous mode. The value is frozen when the channel is
+*              stopped and is the timeout value once a one-shot channel expired.
+************************************************************************************/
+#if (GPT_TIME_ELAPSED_API == STD_ON)
+Gpt_ValueType Gpt_GetTimeElapsed(Gpt_ChannelType Channel)
+{
+	Gpt_ValueType Elapsed = 0;
+	boolean error = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	error = Gpt_CheckChannel(Channel, GPT_GET_TIME_ELAPSED_SID);
+#endif
+
+	/* In-case there are no errors */
+	if (FALSE == error)
+	{
+		/* The channel state is updated by its interrupt */
+		SchM_Enter_Gpt_GPT_EXCLUSIVE_AREA_0();
+		Elapsed = Gpt_ChannelElapsed(Channel);
+		SchM_Exit_Gpt_GPT_EXCLUSIVE_AREA_0();
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return Elapsed;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_GetTimeRemaining
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpt_ValueType - Remaining timer value (in number of ticks)
+* Description: Function to get the time remaining until the next timeout of the channel,
+*              0 before the channel is started and once a one-shot channel expired.
+************************************************************************************/
+#if (GPT_TIME_REMAINING_API == STD_ON)
+Gpt_ValueType Gpt_GetTimeRemaining(Gpt_ChannelType Channel)
+{
+	Gpt_ValueType Remaining = 0;
+	boolean error = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	error = Gpt_CheckChannel(Channel, GPT_GET_TIME_REMAINING_SID);
+#endif
+
+	/* In-case there are no errors */
+	if (FALSE == error)
+	{
+		SchM_Enter_Gpt_GPT_EXCLUSIVE_AREA_0();
+		if (GPT_CHANNEL_INITIALIZED != Gpt_Channel_State[Channel].State)
+		{
+			Remaining = Gpt_Channel_State[Channel].Target - Gpt_ChannelElapsed(Channel);
+		}
+		SchM_Exit_Gpt_GPT_EXCLUSIVE_AREA_0();
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return Remaining;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_StartTimer
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+*                  Value - Target time in number of ticks.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start a channel, it times out after Value ticks: once in one-shot
+*              mode, every Value ticks in continuous mode.
+************************************************************************************/
+void Gpt_StartTimer(Gpt_ChannelType Channel, Gpt_ValueType Value)
+{
+	const Gpt_ConfigChannel * Config;
+	volatile uint8 * Base;
+	uint8 Irq;
+	boolean error = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	error = Gpt_CheckChannel(Channel, GPT_START_TIMER_SID);
+	if (FALSE == error)
+	{
+		/* The counter is loaded with Value - 1 */
+		if ((0 == Value) || ((Value - 1U) > Gpt_MaxValue(&Gpt_Channels[Channel])))
+		{
+			Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_START_TIMER_SID, GPT_E_PARAM_VALUE);
+			error = TRUE;
+		}
+		else if (GPT_CHANNEL_RUNNING == Gpt_Channel_State[Channel].State)
+		{
+			Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_START_TIMER_SID, GPT_E_BUSY);
+			error = TRUE;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+#endif
+
+	/* In-case there are no errors */
+	if (FALSE == error)
+	{
+		Config = &Gpt_Channels[Channel];
+		Base   = Gpt_Timer_Base[Config->Timer];
+		Irq    = Gpt_SubTimer_Irq[Gpt_SubTimerIndex(Config)];
+
+		/* The control register is shared with the other half of the timer */
+		SchM_Enter_Gpt_GPT_EXCLUSIVE_AREA_0();
+		GPT_REG(Base, GPT_CTL_REG_OFFSET) &= ~Gpt_SubTimerMask(Config, GPT_TAEN_MASK);
+		/* Drop a timeout of the previous run that was not served yet */
+		GPT_REG(Base, GPT_ICR_REG_OFFSET)  = Gpt_SubTimerMask(Config, GPT_TATOIM_MASK);
+		Irq_ClearPending(IRQ_VECTOR(Irq));
+		Gpt_LoadCounter(Config, Value - 1U);
+		Gpt_Channel_State[Channel].Target = Value;
+		Gpt_Channel_State[Channel].State  = GPT_CHANNEL_RUNNING;
+		GPT_REG(Base, GPT_CTL_REG_OFFSET) |= Gpt_SubTimerMask(Config, GPT_TAEN_MASK);
+		SchM_Exit_Gpt_GPT_EXCLUSIVE_AREA_0();
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Gpt_StopTimer
+* Service ID[hex]: 0x06
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop a running channel, the elapsed time is kept. A one-shot
+*              channel that already timed out is left to expire with its notification.
+************************************************************************************/
+void Gpt_StopTimer(Gpt_ChannelType Channel)
+{
+	const Gpt_ConfigChannel * Config;
+	volatile uint8 * Base;
+	uint8 Irq;
+	boolean error = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	error = Gpt_CheckChannel(Channel, GPT_STOP_TIMER_SID);
+#endif
+
+	/* In-case there are no errors */
+	if (FALSE == error)
+	{
+		Config = &Gpt_Channels[Channel];
+		Base   = Gpt_Timer_Base[Config->Timer];
+		Irq    = Gpt_SubTimer_Irq[Gpt_SubTimerIndex(Config)];
+
+		SchM_Enter_Gpt_GPT_EXCLUSIVE_AREA_0();
+		if ((GPT_CHANNEL_RUNNING == Gpt_Channel_State[Channel].State)
+		    && !((GPT_CH_MODE_ONESHOT == Config->Mode) && Gpt_TimedOut(Config)))
+		{
+			GPT_REG(Base, GPT_CTL_REG_OFFSET) &= ~Gpt_SubTimerMask(Config, GPT_TAEN_MASK);
+			Gpt_Channel_State[Channel].Stop_Elapsed = Gpt_ChannelElapsed(Channel);
+			Gpt_Channel_State[Channel].State        = GPT_CHANNEL_STOPPED;
+			/* No notification after the stop */
+			GPT_REG(Base, GPT_ICR_REG_OFFSET) = Gpt_SubTimerMask(Config, GPT_TATOIM_MASK);
+			Irq_ClearPending(IRQ_VECTOR(Irq));
+		}
+		SchM_Exit_Gpt_GPT_EXCLUSIVE_AREA_0();
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Gpt_EnableNotification
+* Service ID[hex]: 0x07
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the notification of a channel on its timeouts.
+************************************************************************************/
+#if (GPT_ENABLE_DISABLE_NOTIFICATION_API == STD_ON)
+void Gpt_EnableNotification(Gpt_ChannelType Channel)
+{
+	boolean error = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	error = Gpt_CheckChannel(Channel, GPT_ENABLE_NOTIFICATION_SID);
+	/* Check if the channel has a notification function */
+	if ((FALSE == error) && (NULL_PTR == Gpt_Channels[Channel].Notification))
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_ENABLE_NOTIFICATION_SID, GPT_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+#endif
+
+	/* In-case there are no errors */
+	if (FALSE == error)
+	{
+		Gpt_Channel_State[Channel].Notification_Enabled = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Gpt_DisableNotification
+* Service ID[hex]: 0x08
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to disable the notification of a channel, the channel keeps running.
+************************************************************************************/
+void Gpt_DisableNotification(Gpt_ChannelType Channel)
+{
+	boolean error = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	error = Gpt_CheckChannel(Channel, GPT_DISABLE_NOTIFICATION_SID);
+	/* Check if the channel has a notification function */
+	if ((FALSE == error) && (NULL_PTR == Gpt_Channels[Channel].Notification))
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_DISABLE_NOTIFICATION_SID, GPT_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+#endif
+
+	/* In-case there are no errors */
+	if (FALSE == error)
+	{
+		Gpt_Channel_State[Channel].Notification_Enabled = FALSE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_GetVersionInfo
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): VersionInfo - Pointer to where to store the version information of this module.
+* Return value: None
+* Description: Function to get the version information of this module.
+************************************************************************************/
+#if (GPT_VERSION_INFO_API == STD_ON)
+void Gpt_GetVersionInfo(Std_VersionInfoType *versioninfo)
+{
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	/* Check if input pointer is not Null pointer */
+	if(NULL_PTR == versioninfo)
+	{
+		/* Report to DET  */
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID,
+				GPT_GET_VERSION_INFO_SID, GPT_E_PARAM_POINTER);
+	}
+	else
+#endif /* (GPT_DEV_ERROR_DETECT == STD_ON) */
+	{
+		/* Copy the vendor Id */
+		versioninfo->vendorID = (uint16)GPT_VENDOR_ID;
+		/* Copy the module Id */
+		versioninfo->moduleID = (uint16)GPT_MODULE_ID;
+		/* Copy Software Major Version */
+		versioninfo->sw_major_version = (uint8)GPT_SW_MAJOR_VERSION;
+		/* Copy Software Minor Version */
+		versioninfo->sw_minor_version = (uint8)GPT_SW_MINOR_VERSION;
+		/* Copy Software Patch Version */
+		versioninfo->sw_patch_version = (uint8)GPT_SW_PATCH_VERSION;
+	}
+}
+#endif
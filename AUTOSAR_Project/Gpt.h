@@ -4,7 +4,9 @@
  *
  * File Name: Gpt.h
  *
- * Description: Header file for TM4C123GH6PM Microcontroller - SysTick Timer Driver.
+ * Description: Header file for TM4C123GH6PM Microcontroller - Gpt Driver: the
+ *              channels on the general purpose and wide timers and the SysTick
+ *              timer of the Os.
  *
  * Author: Mohannad Sabry
  ******************************************************************************/
@@ -12,26 +14,263 @@
 #ifndef GPT_H
 #define GPT_H
 
+/* Id for the company in the AUTOSAR
+ * for example Mohannad Sabry's ID = 5000 :) */
+#define GPT_VENDOR_ID    (5000U)
+
+/* Gpt Module Id */
+#define GPT_MODULE_ID    (100U)
+
+/* Gpt Instance Id */
+#define GPT_INSTANCE_ID  (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define GPT_SW_MAJOR_VERSION           (1U)
+#define GPT_SW_MINOR_VERSION           (0U)
+#define GPT_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define GPT_AR_RELEASE_MAJOR_VERSION   (4U)
+#define GPT_AR_RELEASE_MINOR_VERSION   (0U)
+#define GPT_AR_RELEASE_PATCH_VERSION   (3U)
+
+/*
+ * Macros for Gpt Status
+ */
+#define GPT_INITIALIZED                (1U)
+#define GPT_NOT_INITIALIZED            (0U)
+
+/* Standard AUTOSAR types */
 #include "Std_Types.h"
 
+/* AUTOSAR checking between Std Types and Gpt Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Gpt Pre-Compile Configuration Header file */
+#include "Gpt_Cfg.h"
+
+/* AUTOSAR Version checking between Gpt_Cfg.h and Gpt.h files */
+#if ((GPT_CFG_AR_RELEASE_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION)\
+ ||  (GPT_CFG_AR_RELEASE_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION)\
+ ||  (GPT_CFG_AR_RELEASE_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Gpt_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Gpt_Cfg.h and Gpt.h files */
+#if ((GPT_CFG_SW_MAJOR_VERSION != GPT_SW_MAJOR_VERSION)\
+ ||  (GPT_CFG_SW_MINOR_VERSION != GPT_SW_MINOR_VERSION)\
+ ||  (GPT_CFG_SW_PATCH_VERSION != GPT_SW_PATCH_VERSION))
+  #error "The SW version of Gpt_Cfg.h does not match the expected version"
+#endif
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for GPT GetVersionInfo */
+#define GPT_GET_VERSION_INFO_SID       (uint8)0x00
+
+/* Service ID for GPT Init */
+#define GPT_INIT_SID                   (uint8)0x01
+
+/* Service ID for GPT DeInit */
+#define GPT_DEINIT_SID                 (uint8)0x02
+
+/* Service ID for GPT GetTimeElapsed */
+#define GPT_GET_TIME_ELAPSED_SID       (uint8)0x03
+
+/* Service ID for GPT GetTimeRemaining */
+#define GPT_GET_TIME_REMAINING_SID     (uint8)0x04
+
+/* Service ID for GPT StartTimer */
+#define GPT_START_TIMER_SID            (uint8)0x05
+
+/* Service ID for GPT StopTimer */
+#define GPT_STOP_TIMER_SID             (uint8)0x06
+
+/* Service ID for GPT EnableNotification */
+#define GPT_ENABLE_NOTIFICATION_SID    (uint8)0x07
+
+/* Service ID for GPT DisableNotification */
+#define GPT_DISABLE_NOTIFICATION_SID   (uint8)0x08
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* API service used without module initialization */
+#define GPT_E_UNINIT                   (uint8)0x0A
+
+/* Gpt_StartTimer called on a running channel or Gpt_DeInit called with a running channel */
+#define GPT_E_BUSY                     (uint8)0x0B
+
+/* Gpt_Init called while the module is already initialized */
+#define GPT_E_ALREADY_INITIALIZED      (uint8)0x0D
+
+/* Gpt_Init called with a configuration the timers can not implement */
+#define GPT_E_PARAM_CONFIG             (uint8)0x0E
+
+/* DET code to report an invalid channel or a channel without notification */
+#define GPT_E_PARAM_CHANNEL            (uint8)0x14
+
+/* DET code to report a timeout value of 0 or above the width of the channel */
+#define GPT_E_PARAM_VALUE              (uint8)0x15
+
+/* DET code to report a NULL_PTR parameter */
+#define GPT_E_PARAM_POINTER            (uint8)0x16
+
+/* Number of the log-scale buckets of the SysTick jitter histogram, the first one
+ * covers 0 .. 15 cycles and the last one everything above */
+#define SYSTICK_JITTER_BUCKETS         (8U)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for Gpt_ChannelType used by the GPT APIs */
+typedef uint8 Gpt_ChannelType;
+
+/* Type definition for Gpt_ValueType used by the GPT APIs, the values are in timer ticks */
+#if (GPT_64BIT_VALUE_SUPPORT == STD_ON)
+typedef uint64 Gpt_ValueType;
+#else
+typedef uint32 Gpt_ValueType;
+#endif
+
+/* Type definition for the notification function of a channel */
+typedef void (*Gpt_NotificationType)(void);
+
+/* Description: Enum to hold the timer module of a channel */
+typedef enum
+{
+    GPT_TIMER_0, GPT_TIMER_1, GPT_TIMER_2, GPT_TIMER_3, GPT_TIMER_4, GPT_TIMER_5,
+    GPT_WIDE_TIMER_0, GPT_WIDE_TIMER_1, GPT_WIDE_TIMER_2, GPT_WIDE_TIMER_3, GPT_WIDE_TIMER_4, GPT_WIDE_TIMER_5
+} Gpt_HwTimerType;
+
+/*
+ * Description: Enum to hold the part of the timer module used by a channel: one half (16-bit
+ *              on a timer, 32-bit on a wide timer, with a prescaler) or both halves concatenated
+ *              (32-bit on a timer, 64-bit on a wide timer)
+ */
+typedef enum
+{
+    GPT_SUBTIMER_A, GPT_SUBTIMER_B, GPT_SUBTIMER_CONCATENATED
+} Gpt_SubTimerType;
+
+/* Description: Enum to hold the mode of a channel */
+typedef enum
+{
+    GPT_CH_MODE_CONTINUOUS, GPT_CH_MODE_ONESHOT
+} Gpt_ChannelModeType;
+
+/* Description: Structure to hold the configuration of one channel */
+typedef struct
+{
+    /* Timer module and part of it used by the channel */
+    Gpt_HwTimerType Timer;
+    Gpt_SubTimerType SubTimer;
+    /* Continuous: restarts at every timeout, one-shot: stops at the timeout */
+    Gpt_ChannelModeType Mode;
+    /* The timer ticks every Prescale + 1 clock cycles, up to 0xFF on a timer half and 0xFFFF
+     * on a wide timer half. Must be 0 for the concatenated halves */
+    uint16 Prescale;
+    /* Function called on every timeout once enabled by Gpt_EnableNotification, or NULL_PTR */
+    Gpt_NotificationType Notification;
+} Gpt_ConfigChannel;
+
+/* Data Structure required for initializing the Gpt Driver */
+typedef struct Gpt_ConfigType
+{
+    Gpt_ConfigChannel Channels[GPT_CONFIGURED_CHANNELS];
+} Gpt_ConfigType;
+
+#if (GPT_SYSTICK_LATENCY_MEASUREMENT == STD_ON)
+/* Description: Structure to hold the measured SysTick interrupt timing in clock cycles */
+typedef struct
+{
+    /* Number of the measured interrupts */
+    uint32 Count;
+    /* Shortest and longest time from the end of a period to the first instruction of the ISR */
+    uint32 LatencyMin;
+    uint32 LatencyMax;
+    /* Interrupts served after the end of the following period, not in the latency figures */
+    uint32 Overruns;
+    /* Number of the ticks that called the callback (Os activations) */
+    uint32 Activations;
+    /* Shortest and longest run of the callback */
+    uint32 CallbackMin;
+    uint32 CallbackMax;
+    /* Deviation of the time between two activations from the tick time, i.e. change of the
+     * latency from one activation to the next: smallest (most negative) and largest */
+    sint32 JitterMin;
+    sint32 JitterMax;
+    /* Number of activations in every log-scale bucket of the absolute jitter */
+    uint32 JitterHistogram[SYSTICK_JITTER_BUCKETS];
+} SysTick_LatencyType;
+#endif
+
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
 
+/* Function for GPT Initialization API */
+void Gpt_Init(const Gpt_ConfigType * ConfigPtr);
+
+#if (GPT_DEINIT_API == STD_ON)
+/* Function for GPT DeInit API, all the channels must be stopped */
+void Gpt_DeInit(void);
+#endif
+
+#if (GPT_TIME_ELAPSED_API == STD_ON)
+/* Function for GPT GetTimeElapsed API: ticks since the channel was started or its last timeout */
+Gpt_ValueType Gpt_GetTimeElapsed(Gpt_ChannelType Channel);
+#endif
+
+#if (GPT_TIME_REMAINING_API == STD_ON)
+/* Function for GPT GetTimeRemaining API: ticks until the next timeout of the channel */
+Gpt_ValueType Gpt_GetTimeRemaining(Gpt_ChannelType Channel);
+#endif
+
+/* Function for GPT StartTimer API: the channel times out after Value ticks */
+void Gpt_StartTimer(Gpt_ChannelType Channel, Gpt_ValueType Value);
+
+/* Function for GPT StopTimer API */
+void Gpt_StopTimer(Gpt_ChannelType Channel);
+
+#if (GPT_ENABLE_DISABLE_NOTIFICATION_API == STD_ON)
+/* Function for GPT EnableNotification API */
+void Gpt_EnableNotification(Gpt_ChannelType Channel);
+
+/* Function for GPT DisableNotification API */
+void Gpt_DisableNotification(Gpt_ChannelType Channel);
+#endif
+
+/* Function for GPT Get Version Info API */
+#if (GPT_VERSION_INFO_API == STD_ON)
+void Gpt_GetVersionInfo(Std_VersionInfoType *versioninfo);
+#endif
+
 /************************************************************************************
 * Service Name: SysTick_Start
 * Sync/Async: Synchronous
 * Reentrancy: reentrant
-* Parameters (in): Tick_Time - Time in miliseconds
+* Parameters (in): Tick_Time_Us - Time in microseconds
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description: Function to Setup the SysTick Timer configuration to count n miliseconds:
-*              - Set the Reload value
-*              - Enable SysTick Timer with System clock 16Mhz
+* Description: Function to Setup the SysTick Timer configuration to count n microseconds:
+*              - Derive the tick length from the core clock given by Mcu_GetCoreClockHz
+*              - Split it in periods that fit the 24-bit counter without long-term drift
+*              - Enable SysTick Timer with the System clock
 *              - Enable SysTick Timer Interrupt and set its priority
 ************************************************************************************/	
-void SysTick_Start(uint16 Tick_Time);
+void SysTick_Start(uint32 Tick_Time_Us);
 
 /************************************************************************************
 * Service Name: SysTick_Stop
@@ -57,4 +296,110 @@ void SysTick_Stop(void);
 ************************************************************************************/
 void SysTick_SetCallBack(void (*Ptr2Func)(void));
 
+/************************************************************************************
+* Service Name: SysTick_GetMaxSuppressedTicks
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Maximum number of ticks that fit in one tickless period
+* Description: Function to get the longest tickless period the 24-bit SysTick counter
+*              can count with the tick time given to SysTick_Start, 1 when a tick is
+*              longer than the counter and can not be suppressed.
+************************************************************************************/
+uint32 SysTick_GetMaxSuppressedTicks(void);
+
+/************************************************************************************
+* Service Name: SysTick_SuppressTicks
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Ticks - Number of tick periods until the next interrupt (2 .. SysTick_GetMaxSuppressedTicks)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_NOT_OK if the current tick already expired or Ticks is out of range
+* Description: Function to start a tickless period. The next SysTick interrupt is moved
+*              to the end of the given number of ticks counted from the last tick.
+*              Must be called with interrupts disabled and followed by SysTick_ResumeTicks.
+************************************************************************************/
+Std_ReturnType SysTick_SuppressTicks(uint32 Ticks);
+
+/************************************************************************************
+* Service Name: SysTick_ResumeTicks
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Number of whole tick periods elapsed during the tickless period
+* Description: Function to end a tickless period, the elapsed time is corrected from the
+*              counter value and the periodic tick is restarted on the original tick grid.
+*              Must be called with interrupts disabled.
+************************************************************************************/
+uint32 SysTick_ResumeTicks(void);
+
+/************************************************************************************
+* Service Name: SysTick_GetTickCycles
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Number of clock cycles in one tick period
+* Description: Function to get the length of the tick period given to SysTick_Start in
+*              whole clock cycles, the ticks are one cycle longer from time to time to
+*              count the fraction of a cycle left out.
+************************************************************************************/
+uint32 SysTick_GetTickCycles(void);
+
+/************************************************************************************
+* Service Name: SysTick_GetElapsedCycles
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Number of clock cycles since the last tick served by the ISR
+* Description: Function to get the time elapsed in the current tick period. A tick that
+*              expired but whose interrupt is still pending is counted in the result, so
+*              it can exceed one tick period. Must be called with interrupts disabled and
+*              not during a tickless period.
+************************************************************************************/
+uint32 SysTick_GetElapsedCycles(void);
+
+#if (GPT_SYSTICK_LATENCY_MEASUREMENT == STD_ON)
+/************************************************************************************
+* Service Name: SysTick_GetLatencyStatistics
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Statistics - Latency, callback and jitter figures measured so far
+* Return value: Std_ReturnType - E_NOT_OK if Statistics is a null pointer
+* Description: Function to get the SysTick interrupt timing measured by the ISR. The
+*              latency is taken from the counter value read on entry, so it includes the
+*              interrupts masked or running at a higher priority when the tick expired.
+************************************************************************************/
+Std_ReturnType SysTick_GetLatencyStatistics(SysTick_LatencyType * Statistics);
+
+/************************************************************************************
+* Service Name: SysTick_ResetLatencyStatistics
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to restart the SysTick interrupt timing measurement.
+************************************************************************************/
+void SysTick_ResetLatencyStatistics(void);
+#endif
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by Gpt and other modules */
+extern const Gpt_ConfigType Gpt_Configuration;
+
 #endif /* GPT_H */
@@ -0,0 +1,72 @@
+ /******************************************************************************
+ *
+ * Module: Gpt
+ *
+ * File Name: Gpt_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Gpt Driver
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#ifndef GPT_CFG_H
+#define GPT_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define GPT_CFG_SW_MAJOR_VERSION              (1U)
+#define GPT_CFG_SW_MINOR_VERSION              (0U)
+#define GPT_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define GPT_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define GPT_CFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define GPT_CFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* Pre-compile option for Development Error Detect */
+#define GPT_DEV_ERROR_DETECT                (STD_ON)
+
+/* Pre-compile option for Version Info API */
+#define GPT_VERSION_INFO_API                (STD_OFF)
+
+/* Pre-compile option for presence of Gpt_DeInit API */
+#define GPT_DEINIT_API                      (STD_ON)
+
+/* Pre-compile option for presence of Gpt_GetTimeElapsed API */
+#define GPT_TIME_ELAPSED_API                (STD_ON)
+
+/* Pre-compile option for presence of Gpt_GetTimeRemaining API */
+#define GPT_TIME_REMAINING_API              (STD_ON)
+
+/* Pre-compile option for presence of Gpt_EnableNotification and Gpt_DisableNotification APIs */
+#define GPT_ENABLE_DISABLE_NOTIFICATION_API (STD_ON)
+
+/* Pre-compile option for 64-bit timer values (Gpt_ValueType is uint64), needed by the channels
+ * on the two concatenated halves of a wide timer */
+#define GPT_64BIT_VALUE_SUPPORT             (STD_ON)
+
+/* Wide Timer 5 is the budget timer of the Os timing protection (its vector is
+ * Os_ProtectionTimerHandler), no channel can be configured on it */
+#define GPT_WIDE_TIMER_5_RESERVED           (STD_ON)
+
+/* Pre-compile option for the measurement of the SysTick interrupt latency, callback duration
+ * and tick activation jitter (SysTick_GetLatencyStatistics) */
+#define GPT_SYSTICK_LATENCY_MEASUREMENT     (STD_ON)
+
+/* NVIC priority level of the channel interrupts, masked by the Gpt exclusive area (SCHM_BASEPRI_LEVEL or below) */
+#define GPT_INTERRUPT_PRIORITY              (3U)
+
+/* NVIC priority level of the SysTick interrupt, masked by the Gpt exclusive area (SCHM_BASEPRI_LEVEL or below) */
+#define GPT_SYSTICK_INTERRUPT_PRIORITY      (3U)
+
+/* Number of the configured Gpt Channels */
+#define GPT_CONFIGURED_CHANNELS             (2U)
+
+/* Channel Index in the array of structures in Gpt_PBcfg.c */
+#define GptConf_FREE_RUNNING_CHANNEL_ID     (Gpt_ChannelType)0x00   /* Wide Timer 0, 64-bit continuous */
+#define GptConf_ONE_SHOT_CHANNEL_ID         (Gpt_ChannelType)0x01   /* Timer 0A, 16-bit one-shot */
+
+#endif /* GPT_CFG_H */
@@ -0,0 +1,101 @@
+ /******************************************************************************
+ *
+ * Module: Gpt
+ *
+ * File Name: Gpt_Regs.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Gpt Driver Registers.
+ *              The base addresses can be defined by the build to point the
+ *              driver to simulated register blocks, e.g. in a host build.
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#ifndef GPT_REGS_H
+#define GPT_REGS_H
+
+#include "Std_Types.h"
+
+/* 16/32-bit Timers base addresses */
+#ifndef GPT_TIMER0_BASE_ADDRESS
+#define GPT_TIMER0_BASE_ADDRESS           ((volatile uint8 *)0x40030000)
+#endif
+#ifndef GPT_TIMER1_BASE_ADDRESS
+#define GPT_TIMER1_BASE_ADDRESS           ((volatile uint8 *)0x40031000)
+#endif
+#ifndef GPT_TIMER2_BASE_ADDRESS
+#define GPT_TIMER2_BASE_ADDRESS           ((volatile uint8 *)0x40032000)
+#endif
+#ifndef GPT_TIMER3_BASE_ADDRESS
+#define GPT_TIMER3_BASE_ADDRESS           ((volatile uint8 *)0x40033000)
+#endif
+#ifndef GPT_TIMER4_BASE_ADDRESS
+#define GPT_TIMER4_BASE_ADDRESS           ((volatile uint8 *)0x40034000)
+#endif
+#ifndef GPT_TIMER5_BASE_ADDRESS
+#define GPT_TIMER5_BASE_ADDRESS           ((volatile uint8 *)0x40035000)
+#endif
+
+/* 32/64-bit Wide Timers base addresses */
+#ifndef GPT_WTIMER0_BASE_ADDRESS
+#define GPT_WTIMER0_BASE_ADDRESS          ((volatile uint8 *)0x40036000)
+#endif
+#ifndef GPT_WTIMER1_BASE_ADDRESS
+#define GPT_WTIMER1_BASE_ADDRESS          ((volatile uint8 *)0x40037000)
+#endif
+#ifndef GPT_WTIMER2_BASE_ADDRESS
+#define GPT_WTIMER2_BASE_ADDRESS          ((volatile uint8 *)0x4004C000)
+#endif
+#ifndef GPT_WTIMER3_BASE_ADDRESS
+#define GPT_WTIMER3_BASE_ADDRESS          ((volatile uint8 *)0x4004D000)
+#endif
+#ifndef GPT_WTIMER4_BASE_ADDRESS
+#define GPT_WTIMER4_BASE_ADDRESS          ((volatile uint8 *)0x4004E000)
+#endif
+#ifndef GPT_WTIMER5_BASE_ADDRESS
+#define GPT_WTIMER5_BASE_ADDRESS          ((volatile uint8 *)0x4004F000)
+#endif
+
+/* System Control base address */
+#ifndef GPT_SYSCTL_BASE_ADDRESS
+#define GPT_SYSCTL_BASE_ADDRESS           ((volatile uint8 *)0x400FE000)
+#endif
+
+/* SysTick block and System Control Block of the core */
+#ifndef GPT_SYSTICK_BASE_ADDRESS
+#define GPT_SYSTICK_BASE_ADDRESS          ((volatile uint8 *)0xE000E010)
+#endif
+#ifndef GPT_SCB_BASE_ADDRESS
+#define GPT_SCB_BASE_ADDRESS              ((volatile uint8 *)0xE000ED00)
+#endif
+
+/* Timer Registers offset addresses, the timer B registers follow the timer A ones */
+#define GPT_CFG_REG_OFFSET                0x000
+#define GPT_TAMR_REG_OFFSET               0x004
+#define GPT_CTL_REG_OFFSET                0x00C
+#define GPT_IMR_REG_OFFSET                0x018
+#define GPT_RIS_REG_OFFSET                0x01C
+#define GPT_ICR_REG_OFFSET                0x024
+#define GPT_TAILR_REG_OFFSET              0x028
+#define GPT_TBILR_REG_OFFSET              0x02C
+#define GPT_TAPR_REG_OFFSET               0x038
+#define GPT_TAV_REG_OFFSET                0x050
+#define GPT_TBV_REG_OFFSET                0x054
+#define GPT_TIMER_B_REG_STEP              0x004
+
+/* System Control Registers offset addresses (clock gating and peripheral ready) */
+#define GPT_RCGCTIMER_REG_OFFSET          0x604
+#define GPT_RCGCWTIMER_REG_OFFSET         0x65C
+#define GPT_PRTIMER_REG_OFFSET            0xA04
+#define GPT_PRWTIMER_REG_OFFSET           0xA5C
+
+/* Access to a 32-bit register of a block */
+#define GPT_REG(Base, Offset)             (*((volatile uint32 *)((Base) + (Offset))))
+
+/* SysTick Registers and the Interrupt Control and State Register (pending SysTick) */
+#define GPT_SYSTICK_CTRL_REG              GPT_REG(GPT_SYSTICK_BASE_ADDRESS, 0x000)
+#define GPT_SYSTICK_RELOAD_REG            GPT_REG(GPT_SYSTICK_BASE_ADDRESS, 0x004)
+#define GPT_SYSTICK_CURRENT_REG           GPT_REG(GPT_SYSTICK_BASE_ADDRESS, 0x008)
+#define GPT_INTCTRL_REG                   GPT_REG(GPT_SCB_BASE_ADDRESS, 0x004)
+
+#endif /* GPT_REGS_H */
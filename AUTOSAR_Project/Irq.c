@@ -0,0 +1,667 @@
+ /******************************************************************************
+ *
+ * Module: Irq
+ *
+ * File Name: Irq.c
+ *
+ * Description: Source file for TM4C123GH6PM Microcontroller - Irq Driver.
+ *              ResetISR copies the flash vector table to the .vtable section
+ *              (0x20000000) and points VTOR to it, Irq_Register installs the
+ *              ISRs there so the NVIC calls them with no dispatch in between.
+ *              Irq_Init programs the priority of every vector from one table
+ *              and Irq_CheckPriorities reports the ISRs the exclusive areas
+ *              do not protect or hold off for nothing.
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#include "Irq.h"
+#include "Irq_Regs.h"
+#include "SchM.h"
+#include "tm4c123gh6pm_registers.h"
+
+#if (IRQ_DEV_ERROR_DETECT == STD_ON)
+
+#include "Det.h"
+/* AUTOSAR Version checking between Det and Irq Modules */
+#if ((DET_AR_MAJOR_VERSION != IRQ_AR_RELEASE_MAJOR_VERSION)\
+ || (DET_AR_MINOR_VERSION != IRQ_AR_RELEASE_MINOR_VERSION)\
+ || (DET_AR_PATCH_VERSION != IRQ_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Det.h does not match the expected version"
+#endif
+
+#endif
+
+#if (IRQ_PREEMPTION_BITS > IRQ_PRIORITY_BITS)
+  #error "IRQ_PREEMPTION_BITS can not be above the 3 implemented priority bits"
+#endif
+
+#if (SCHM_EXCLUSIVE_AREA_COUNT > 8U)
+  #error "The ExclusiveAreas mask of the Irq configuration holds 8 exclusive areas"
+#endif
+
+/* Completes the vector write before the interrupt can be taken with the new handler */
+#define Irq_DataSyncBarrier()    __asm(" DSB ")
+
+/* PRIGROUP: the preemption bits are the top IRQ_PREEMPTION_BITS of the 8-bit priority field */
+#define IRQ_PRIGROUP             (7U - IRQ_PREEMPTION_BITS)
+
+/* Preemption (group) priority of a priority level: only the group decides if an interrupt
+ * preempts another one or is masked by BASEPRI, the subpriority orders the pending ones */
+#define IRQ_GROUP(Priority)      ((Priority) >> (IRQ_PRIORITY_BITS - IRQ_PREEMPTION_BITS))
+
+/* Bit of a peripheral interrupt in the 32-bit enable / pend registers of the NVIC */
+#define IRQ_NVIC_WORD(Vector)    (((Vector) - IRQ_FIRST_PERIPHERAL_VECTOR) / 32U)
+#define IRQ_NVIC_BIT(Vector)     ((uint32)1 << (((Vector) - IRQ_FIRST_PERIPHERAL_VECTOR) % 32U))
+
+#if (IRQ_PRIORITY_REPORT == STD_ON)
+/* ITM_TCR enable bit and ITM_TER bit of the stimulus port 0 */
+#define IRQ_ITM_TCR_ITMENA_MASK  0x00000001
+#define IRQ_ITM_TER_PORT0_MASK   0x00000001
+#endif
+
+STATIC const Irq_ConfigType * Irq_ConfigPtr = NULL_PTR;
+STATIC uint8 Irq_Status = IRQ_NOT_INITIALIZED;
+
+#if (IRQ_PRIORITY_REPORT == STD_ON)
+/* Findings of the last Irq_CheckPriorities */
+static Irq_FindingType Irq_Findings[IRQ_REPORT_MAX_FINDINGS];
+static uint8 Irq_FindingCount = 0;
+#endif
+
+static boolean Irq_IsInstallable(Irq_VectorType Vector);
+static void Irq_WritePriority(Irq_VectorType Vector, Irq_PriorityType Priority);
+static Irq_PriorityType Irq_ReadPriority(Irq_VectorType Vector);
+#if (IRQ_PRIORITY_REPORT == STD_ON)
+static boolean Irq_IsEnabled(Irq_VectorType Vector);
+static void Irq_AddFinding(Irq_VectorType Vector, Irq_PriorityType Priority, uint8 Finding);
+static void Irq_ItmPutString(const char * String);
+static void Irq_ItmPutNumber(uint32 Number);
+#endif
+
+/*********************************************************************************************/
+static boolean Irq_IsInstallable(Irq_VectorType Vector)
+{
+    /* The stack pointer, reset, NMI and hard fault entries are fixed, the reserved entries
+     * (0 in the flash table) have no interrupt behind them */
+    return ((Vector >= IRQ_FIRST_CONFIGURABLE_VECTOR) && (Vector < IRQ_VECTOR_COUNT)
+            && (g_pfnVectors[Vector] != NULL_PTR)) ? TRUE : FALSE;
+}
+
+/*********************************************************************************************/
+static void Irq_WritePriority(Irq_VectorType Vector, Irq_PriorityType Priority)
+{
+    /* Byte accesses: the other interrupts sharing the 32-bit register are not touched */
+    if(Vector >= IRQ_FIRST_PERIPHERAL_VECTOR)
+    {
+        *(IRQ_NVIC_PRI_BASE_ADDRESS + (Vector - IRQ_FIRST_PERIPHERAL_VECTOR)) = (uint8)(Priority << IRQ_PRIORITY_BITS_POS);
+    }
+    else
+    {
+        *(IRQ_SYSTEM_PRI_BASE_ADDRESS + (Vector - IRQ_FIRST_CONFIGURABLE_VECTOR)) = (uint8)(Priority << IRQ_PRIORITY_BITS_POS);
+    }
+}
+
+/*********************************************************************************************/
+static Irq_PriorityType Irq_ReadPriority(Irq_VectorType Vector)
+{
+    if(Vector < IRQ_FIRST_CONFIGURABLE_VECTOR)
+    {
+        /* Reset, NMI and hard fault have fixed negative priorities, above every level */
+        return 0;
+    }
+    else if(Vector >= IRQ_FIRST_PERIPHERAL_VECTOR)
+    {
+        return (Irq_PriorityType)(*(IRQ_NVIC_PRI_BASE_ADDRESS + (Vector - IRQ_FIRST_PERIPHERAL_VECTOR)) >> IRQ_PRIORITY_BITS_POS);
+    }
+    else
+    {
+        return (Irq_PriorityType)(*(IRQ_SYSTEM_PRI_BASE_ADDRESS + (Vector - IRQ_FIRST_CONFIGURABLE_VECTOR)) >> IRQ_PRIORITY_BITS_POS);
+    }
+}
+
+/************************************************************************************
+* Service Name: Irq_Init
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to the priority table of the vectors
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the priority grouping and the priority of every vector
+*              the table manages, before any interrupt is enabled. The vectors left to
+*              their owner (IRQ_PRIORITY_UNMANAGED) are not touched.
+************************************************************************************/
+void Irq_Init(const Irq_ConfigType * ConfigPtr)
+{
+    Irq_VectorType Vector;
+
+#if (IRQ_DEV_ERROR_DETECT == STD_ON)
+    if(NULL_PTR == ConfigPtr)
+    {
+        Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID, IRQ_INIT_SID, IRQ_E_PARAM_POINTER);
+        return;
+    }
+#endif
+
+    /* APINT writes are ignored without the key */
+    IRQ_APINT_REG = IRQ_APINT_VECTKEY | ((uint32)IRQ_PRIGROUP << IRQ_APINT_PRIGROUP_POS);
+
+    for(Vector = IRQ_FIRST_CONFIGURABLE_VECTOR; Vector < IRQ_VECTOR_COUNT; Vector++)
+    {
+        if(ConfigPtr->Vectors[Vector].Priority == IRQ_PRIORITY_UNMANAGED)
+        {
+            continue;
+        }
+#if (IRQ_DEV_ERROR_DETECT == STD_ON)
+        if(FALSE == Irq_IsInstallable(Vector))
+        {
+            Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID, IRQ_INIT_SID, IRQ_E_PARAM_VECTOR);
+            continue;
+        }
+        if(ConfigPtr->Vectors[Vector].Priority >= IRQ_PRIORITY_LEVELS)
+        {
+            Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID, IRQ_INIT_SID, IRQ_E_PARAM_PRIORITY);
+            continue;
+        }
+#endif
+        Irq_WritePriority(Vector, ConfigPtr->Vectors[Vector].Priority);
+    }
+
+    Irq_ConfigPtr = ConfigPtr;
+    Irq_Status = IRQ_INITIALIZED;
+}
+
+/************************************************************************************
+* Service Name: Irq_Register
+* Service ID[hex]: 0x01
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Vector - Exception number (IRQ_VECTOR(IrqNumber) for a peripheral)
+*                  Handler - ISR to install
+*                  Priority - Priority level of the interrupt (0 .. 7)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_NOT_OK for an invalid parameter
+* Description: Function to install an ISR in the RAM vector table and set its priority.
+*              The interrupt is not enabled, so it should be disabled (or not yet enabled)
+*              while its handler is replaced.
+************************************************************************************/
+Std_ReturnType Irq_Register(Irq_VectorType Vector, Irq_HandlerType Handler, Irq_PriorityType Priority)
+{
+#if (IRQ_DEV_ERROR_DETECT == STD_ON)
+    if(FALSE == Irq_IsInstallable(Vector))
+    {
+        Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID, IRQ_REGISTER_SID, IRQ_E_PARAM_VECTOR);
+        return E_NOT_OK;
+    }
+    if(NULL_PTR == Handler)
+    {
+        Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID, IRQ_REGISTER_SID, IRQ_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+    if(Priority >= IRQ_PRIORITY_LEVELS)
+    {
+        Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID, IRQ_REGISTER_SID, IRQ_E_PARAM_PRIORITY);
+        return E_NOT_OK;
+    }
+#endif
+
+    g_pfnRAMVectors[Vector] = Handler;
+    Irq_DataSyncBarrier();
+    Irq_WritePriority(Vector, Priority);
+    return E_OK;
+}
+
+/************************************************************************************
+* Service Name: Irq_Unregister
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Vector - Exception number (IRQ_VECTOR(IrqNumber) for a peripheral)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to put back the handler of the flash vector table (the default
+*              handler for most of the vectors). The priority is left as it is.
+************************************************************************************/
+void Irq_Unregister(Irq_VectorType Vector)
+{
+#if (IRQ_DEV_ERROR_DETECT == STD_ON)
+    if(FALSE == Irq_IsInstallable(Vector))
+    {
+        Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID, IRQ_UNREGISTER_SID, IRQ_E_PARAM_VECTOR);
+        return;
+    }
+#endif
+
+    g_pfnRAMVectors[Vector] = g_pfnVectors[Vector];
+    Irq_DataSyncBarrier();
+}
+
+/************************************************************************************
+* Service Name: Irq_SetPriority
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Vector - Exception number (IRQ_VECTOR(IrqNumber) for a peripheral)
+*                  Priority - Priority level of the interrupt (0 .. 7)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_NOT_OK for an invalid parameter
+* Description: Function to change the priority of a vector at run time. A vector managed
+*              by the configuration table is reported as a mismatch by the priority report.
+************************************************************************************/
+Std_ReturnType Irq_SetPriority(Irq_VectorType Vector, Irq_PriorityType Priority)
+{
+#if (IRQ_DEV_ERROR_DETECT == STD_ON)
+    if(FALSE == Irq_IsInstallable(Vector))
+    {
+        Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID, IRQ_SET_PRIORITY_SID, IRQ_E_PARAM_VECTOR);
+        return E_NOT_OK;
+    }
+    if(Priority >= IRQ_PRIORITY_LEVELS)
+    {
+        Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID, IRQ_SET_PRIORITY_SID, IRQ_E_PARAM_PRIORITY);
+        return E_NOT_OK;
+    }
+#endif
+
+    Irq_WritePriority(Vector, Priority);
+    return E_OK;
+}
+
+/************************************************************************************
+* Service Name: Irq_GetPriority
+* Service ID[hex]: 0x0B
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Vector - Exception number (IRQ_VECTOR(IrqNumber) for a peripheral)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Irq_PriorityType - Priority level in the NVIC, 0 for the fixed vectors
+* Description: Function to read the priority of a vector back from the NVIC.
+************************************************************************************/
+Irq_PriorityType Irq_GetPriority(Irq_VectorType Vector)
+{
+#if (IRQ_DEV_ERROR_DETECT == STD_ON)
+    if(Vector >= IRQ_VECTOR_COUNT)
+    {
+        Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID, IRQ_GET_PRIORITY_SID, IRQ_E_PARAM_VECTOR);
+        return 0;
+    }
+#endif
+
+    return Irq_ReadPriority(Vector);
+}
+
+/************************************************************************************
+* Service Name: Irq_EnableInterrupt
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Vector - Peripheral interrupt vector (IRQ_VECTOR(IrqNumber))
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable a peripheral interrupt in the NVIC. The EN registers
+*              are write-one-to-set, no other interrupt is touched.
+************************************************************************************/
+void Irq_EnableInterrupt(Irq_VectorType Vector)
+{
+#if (IRQ_DEV_ERROR_DETECT == STD_ON)
+    if((Vector < IRQ_FIRST_PERIPHERAL_VECTOR) || (FALSE == Irq_IsInstallable(Vector)))
+    {
+        Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID, IRQ_ENABLE_INTERRUPT_SID, IRQ_E_PARAM_VECTOR);
+        return;
+    }
+#endif
+
+    *(IRQ_NVIC_EN_BASE_ADDRESS + IRQ_NVIC_WORD(Vector)) = IRQ_NVIC_BIT(Vector);
+}
+
+/************************************************************************************
+* Service Name: Irq_DisableInterrupt
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Vector - Peripheral interrupt vector (IRQ_VECTOR(IrqNumber))
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to disable a peripheral interrupt in the NVIC. The interrupt can
+*              still become pending, it is just not taken.
+************************************************************************************/
+void Irq_DisableInterrupt(Irq_VectorType Vector)
+{
+#if (IRQ_DEV_ERROR_DETECT == STD_ON)
+    if((Vector < IRQ_FIRST_PERIPHERAL_VECTOR) || (FALSE == Irq_IsInstallable(Vector)))
+    {
+        Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID, IRQ_DISABLE_INTERRUPT_SID, IRQ_E_PARAM_VECTOR);
+        return;
+    }
+#endif
+
+    *(IRQ_NVIC_DIS_BASE_ADDRESS + IRQ_NVIC_WORD(Vector)) = IRQ_NVIC_BIT(Vector);
+}
+
+/************************************************************************************
+* Service Name: Irq_SetPending
+* Service ID[hex]: 0x06
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Vector - Peripheral interrupt vector, IRQ_VECTOR_PENDSV or IRQ_VECTOR_SYSTICK
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to pend an interrupt from software.
+************************************************************************************/
+void Irq_SetPending(Irq_VectorType Vector)
+{
+    if(IRQ_VECTOR_PENDSV == Vector)
+    {
+        IRQ_INTCTRL_REG = IRQ_INTCTRL_PENDSVSET_MASK;
+    }
+    else if(IRQ_VECTOR_SYSTICK == Vector)
+    {
+        IRQ_INTCTRL_REG = IRQ_INTCTRL_PENDSTSET_MASK;
+    }
+#if (IRQ_DEV_ERROR_DETECT == STD_ON)
+    else if((Vector < IRQ_FIRST_PERIPHERAL_VECTOR) || (FALSE == Irq_IsInstallable(Vector)))
+    {
+        Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID, IRQ_SET_PENDING_SID, IRQ_E_PARAM_VECTOR);
+    }
+#endif
+    else
+    {
+        *(IRQ_NVIC_PEND_BASE_ADDRESS + IRQ_NVIC_WORD(Vector)) = IRQ_NVIC_BIT(Vector);
+    }
+}
+
+/************************************************************************************
+* Service Name: Irq_ClearPending
+* Service ID[hex]: 0x07
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Vector - Peripheral interrupt vector, IRQ_VECTOR_PENDSV or IRQ_VECTOR_SYSTICK
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to drop a pending interrupt that has not been taken yet.
+************************************************************************************/
+void Irq_ClearPending(Irq_VectorType Vector)
+{
+    if(IRQ_VECTOR_PENDSV == Vector)
+    {
+        IRQ_INTCTRL_REG = IRQ_INTCTRL_PENDSVCLR_MASK;
+    }
+    else if(IRQ_VECTOR_SYSTICK == Vector)
+    {
+        IRQ_INTCTRL_REG = IRQ_INTCTRL_PENDSTCLR_MASK;
+    }
+#if (IRQ_DEV_ERROR_DETECT == STD_ON)
+    else if((Vector < IRQ_FIRST_PERIPHERAL_VECTOR) || (FALSE == Irq_IsInstallable(Vector)))
+    {
+        Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID, IRQ_CLEAR_PENDING_SID, IRQ_E_PARAM_VECTOR);
+    }
+#endif
+    else
+    {
+        *(IRQ_NVIC_UNPEND_BASE_ADDRESS + IRQ_NVIC_WORD(Vector)) = IRQ_NVIC_BIT(Vector);
+    }
+}
+
+/************************************************************************************
+* Service Name: Irq_GetPending
+* Service ID[hex]: 0x09
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Vector - Peripheral interrupt vector, IRQ_VECTOR_PENDSV or IRQ_VECTOR_SYSTICK
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE when the interrupt is pending
+* Description: Function to check if an interrupt waits to be taken.
+************************************************************************************/
+boolean Irq_GetPending(Irq_VectorType Vector)
+{
+    if(IRQ_VECTOR_PENDSV == Vector)
+    {
+        return ((IRQ_INTCTRL_REG & IRQ_INTCTRL_PENDSVSET_MASK) != 0) ? TRUE : FALSE;
+    }
+    else if(IRQ_VECTOR_SYSTICK == Vector)
+    {
+        return ((IRQ_INTCTRL_REG & IRQ_INTCTRL_PENDSTSET_MASK) != 0) ? TRUE : FALSE;
+    }
+#if (IRQ_DEV_ERROR_DETECT == STD_ON)
+    else if((Vector < IRQ_FIRST_PERIPHERAL_VECTOR) || (FALSE == Irq_IsInstallable(Vector)))
+    {
+        Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID, IRQ_GET_PENDING_SID, IRQ_E_PARAM_VECTOR);
+        return FALSE;
+    }
+#endif
+    else
+    {
+        return ((*(IRQ_NVIC_PEND_BASE_ADDRESS + IRQ_NVIC_WORD(Vector)) & IRQ_NVIC_BIT(Vector)) != 0) ? TRUE : FALSE;
+    }
+}
+
+/************************************************************************************
+* Service Name: Irq_GetActive
+* Service ID[hex]: 0x0A
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Vector - Peripheral interrupt vector (IRQ_VECTOR(IrqNumber))
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE when the ISR is running or preempted
+* Description: Function to check if an interrupt is being served.
+************************************************************************************/
+boolean Irq_GetActive(Irq_VectorType Vector)
+{
+#if (IRQ_DEV_ERROR_DETECT == STD_ON)
+    if((Vector < IRQ_FIRST_PERIPHERAL_VECTOR) || (FALSE == Irq_IsInstallable(Vector)))
+    {
+        Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID, IRQ_GET_ACTIVE_SID, IRQ_E_PARAM_VECTOR);
+        return FALSE;
+    }
+#endif
+
+    return ((*(IRQ_NVIC_ACTIVE_BASE_ADDRESS + IRQ_NVIC_WORD(Vector)) & IRQ_NVIC_BIT(Vector)) != 0) ? TRUE : FALSE;
+}
+
+#if (IRQ_PRIORITY_REPORT == STD_ON)
+
+/*********************************************************************************************/
+static boolean Irq_IsEnabled(Irq_VectorType Vector)
+{
+    if(Vector >= IRQ_FIRST_PERIPHERAL_VECTOR)
+    {
+        return ((*(IRQ_NVIC_EN_BASE_ADDRESS + IRQ_NVIC_WORD(Vector)) & IRQ_NVIC_BIT(Vector)) != 0) ? TRUE : FALSE;
+    }
+    /* The system handlers are always able to run (SysTick, PendSV, SVCall and the faults) */
+    return Irq_IsInstallable(Vector);
+}
+
+/*********************************************************************************************/
+static void Irq_AddFinding(Irq_VectorType Vector, Irq_PriorityType Priority, uint8 Finding)
+{
+    if(Irq_FindingCount < IRQ_REPORT_MAX_FINDINGS)
+    {
+        Irq_Findings[Irq_FindingCount].Vector   = Vector;
+        Irq_Findings[Irq_FindingCount].Priority = Priority;
+        Irq_Findings[Irq_FindingCount].Finding  = Finding;
+    }
+    /* Counted even when not kept so the caller sees how many there are */
+    if(Irq_FindingCount < 0xFFU)
+    {
+        Irq_FindingCount++;
+    }
+}
+
+/************************************************************************************
+* Service Name: Irq_CheckPriorities
+* Service ID[hex]: 0x08
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint8 - Number of findings (0 when the priorities are consistent)
+* Description: Function to check the priorities in the NVIC once every module has
+*              installed and enabled its interrupts:
+*              - UNPROTECTED: an ISR sharing data guarded by exclusive areas is above
+*                SCHM_BASEPRI_LEVEL, so it can preempt the critical sections.
+*              - INVERSION: an enabled ISR using no exclusive area is held off by the
+*                critical sections while it is more urgent than every ISR using them.
+*              - MISMATCH: a priority of the table was changed after Irq_Init.
+*              Only the preemption (group) priorities are compared, as BASEPRI does.
+************************************************************************************/
+uint8 Irq_CheckPriorities(void)
+{
+    Irq_VectorType Vector;
+    Irq_PriorityType Priority;
+    Irq_PriorityType Most_Urgent_User = IRQ_PRIORITY_LEVELS;
+    const Irq_ConfigVector * Config;
+
+#if (IRQ_DEV_ERROR_DETECT == STD_ON)
+    if(IRQ_NOT_INITIALIZED == Irq_Status)
+    {
+        Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID, IRQ_CHECK_PRIORITIES_SID, IRQ_E_UNINIT);
+        return 0;
+    }
+#endif
+
+    Irq_FindingCount = 0;
+
+    /* The ISRs sharing data with the critical sections: the unprotected ones and the most
+     * urgent of them, no ISR masked by the areas should be above it */
+    for(Vector = IRQ_FIRST_CONFIGURABLE_VECTOR; Vector < IRQ_VECTOR_COUNT; Vector++)
+    {
+        Config   = &Irq_ConfigPtr->Vectors[Vector];
+        Priority = Irq_ReadPriority(Vector);
+
+        if((Config->Priority != IRQ_PRIORITY_UNMANAGED) && (Config->Priority != Priority))
+        {
+            Irq_AddFinding(Vector, Priority, IRQ_FINDING_MISMATCH);
+        }
+        if((Config->ExclusiveAreas == 0) || (FALSE == Irq_IsEnabled(Vector)))
+        {
+            continue;
+        }
+        if(IRQ_GROUP(Priority) < IRQ_GROUP(SCHM_BASEPRI_LEVEL))
+        {
+            Irq_AddFinding(Vector, Priority, IRQ_FINDING_UNPROTECTED);
+        }
+        if(IRQ_GROUP(Priority) < Most_Urgent_User)
+        {
+            Most_Urgent_User = IRQ_GROUP(Priority);
+        }
+    }
+
+    for(Vector = IRQ_FIRST_CONFIGURABLE_VECTOR; Vector < IRQ_VECTOR_COUNT; Vector++)
+    {
+        if((Irq_ConfigPtr->Vectors[Vector].ExclusiveAreas != 0) || (FALSE == Irq_IsEnabled(Vector)))
+        {
+            continue;
+        }
+        Priority = Irq_ReadPriority(Vector);
+        if((IRQ_GROUP(Priority) >= IRQ_GROUP(SCHM_BASEPRI_LEVEL)) && (IRQ_GROUP(Priority) < Most_Urgent_User))
+        {
+            Irq_AddFinding(Vector, Priority, IRQ_FINDING_INVERSION);
+        }
+    }
+
+    return Irq_FindingCount;
+}
+
+/************************************************************************************
+* Service Name: Irq_GetFinding
+* Service ID[hex]: 0x0C
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Index - Finding of the last Irq_CheckPriorities (0 .. count - 1)
+* Parameters (inout): None
+* Parameters (out): Finding - Vector, priority and kind of the finding
+* Return value: Std_ReturnType - E_NOT_OK when the finding was not kept
+* Description: Function to get one finding of the last Irq_CheckPriorities.
+************************************************************************************/
+Std_ReturnType Irq_GetFinding(uint8 Index, Irq_FindingType * Finding)
+{
+#if (IRQ_DEV_ERROR_DETECT == STD_ON)
+    if(NULL_PTR == Finding)
+    {
+        Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID, IRQ_GET_FINDING_SID, IRQ_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+#endif
+
+    if((Index >= Irq_FindingCount) || (Index >= IRQ_REPORT_MAX_FINDINGS))
+    {
+        return E_NOT_OK;
+    }
+    *Finding = Irq_Findings[Index];
+    return E_OK;
+}
+
+/*********************************************************************************************/
+void Irq_DumpPriorityReport(void)
+{
+    static const char * const Finding_Names[] = { "unprotected", "inversion", "mismatch" };
+    uint8 Index;
+
+    if(((ITM_TCR_REG & IRQ_ITM_TCR_ITMENA_MASK) == 0) || ((ITM_TER_REG & IRQ_ITM_TER_PORT0_MASK) == 0))
+    {
+        /* No debugger listening on the SWO channel */
+        return;
+    }
+
+    /* Irq priorities: <count> findings, then one line per finding kept:
+     * Irq vector <vector>: priority=<level> <finding> */
+    Irq_ItmPutString("Irq priorities: ");
+    Irq_ItmPutNumber(Irq_FindingCount);
+    Irq_ItmPutString(" findings\r\n");
+    for(Index = 0; (Index < Irq_FindingCount) && (Index < IRQ_REPORT_MAX_FINDINGS); Index++)
+    {
+        Irq_ItmPutString("Irq vector ");
+        Irq_ItmPutNumber(Irq_Findings[Index].Vector);
+        Irq_ItmPutString(": priority=");
+        Irq_ItmPutNumber(Irq_Findings[Index].Priority);
+        Irq_ItmPutString(" ");
+        Irq_ItmPutString(Finding_Names[Irq_Findings[Index].Finding]);
+        Irq_ItmPutString("\r\n");
+    }
+}
+
+/*********************************************************************************************/
+static void Irq_ItmPutString(const char * String)
+{
+    while(*String != '\0')
+    {
+        /* The stimulus port reads 1 when its FIFO can take a new character */
+        while(ITM_STIM0_REG == 0)
+        {
+        }
+        *((volatile uint8 *)&ITM_STIM0_REG) = (uint8)*String;
+        String++;
+    }
+}
+
+/*********************************************************************************************/
+static void Irq_ItmPutNumber(uint32 Number)
+{
+    char Digits[11];
+    uint8 Index = 10;
+
+    Digits[10] = '\0';
+    do
+    {
+        Index--;
+        Digits[Index] = (char)('0' + (Number % 10));
+        Number /= 10;
+    } while(Number != 0);
+
+    Irq_ItmPutString(&Digits[Index]);
+}
+
+#endif /* (IRQ_PRIORITY_REPORT == STD_ON) */
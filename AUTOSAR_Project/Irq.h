@@ -0,0 +1,275 @@
+ /******************************************************************************
+ *
+ * Module: Irq
+ *
+ * File Name: Irq.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Irq Driver: the
+ *              vector table copied to RAM by the startup code, where the
+ *              drivers install their ISRs at run time, the priority of every
+ *              vector and the enable / pend controls of the NVIC.
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#ifndef IRQ_H
+#define IRQ_H
+
+/* Id for the company in the AUTOSAR
+ * for example Mohannad Sabry's ID = 5000 :) */
+#define IRQ_VENDOR_ID    (5000U)
+
+/* Irq Module Id (no standard AUTOSAR module, the complex driver Id is used) */
+#define IRQ_MODULE_ID    (255U)
+
+/* Irq Instance Id */
+#define IRQ_INSTANCE_ID  (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define IRQ_SW_MAJOR_VERSION           (1U)
+#define IRQ_SW_MINOR_VERSION           (0U)
+#define IRQ_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define IRQ_AR_RELEASE_MAJOR_VERSION   (4U)
+#define IRQ_AR_RELEASE_MINOR_VERSION   (0U)
+#define IRQ_AR_RELEASE_PATCH_VERSION   (3U)
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/* AUTOSAR checking between Std Types and Irq Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != IRQ_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != IRQ_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != IRQ_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Irq Pre-Compile Configuration Header file */
+#include "Irq_Cfg.h"
+
+/* AUTOSAR Version checking between Irq_Cfg.h and Irq.h files */
+#if ((IRQ_CFG_AR_RELEASE_MAJOR_VERSION != IRQ_AR_RELEASE_MAJOR_VERSION)\
+ ||  (IRQ_CFG_AR_RELEASE_MINOR_VERSION != IRQ_AR_RELEASE_MINOR_VERSION)\
+ ||  (IRQ_CFG_AR_RELEASE_PATCH_VERSION != IRQ_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Irq_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Irq_Cfg.h and Irq.h files */
+#if ((IRQ_CFG_SW_MAJOR_VERSION != IRQ_SW_MAJOR_VERSION)\
+ ||  (IRQ_CFG_SW_MINOR_VERSION != IRQ_SW_MINOR_VERSION)\
+ ||  (IRQ_CFG_SW_PATCH_VERSION != IRQ_SW_PATCH_VERSION))
+  #error "The SW version of Irq_Cfg.h does not match the expected version"
+#endif
+
+/* Number of the vectors of the TM4C123GH6PM: the initial stack pointer, 15 system exceptions
+ * and 139 peripheral interrupts */
+#define IRQ_VECTOR_COUNT               (155U)
+
+/* First vector whose priority is programmable (MPU fault) */
+#define IRQ_FIRST_CONFIGURABLE_VECTOR  (4U)
+
+/* First peripheral interrupt vector (IRQ 0) */
+#define IRQ_FIRST_PERIPHERAL_VECTOR    (16U)
+
+/* System handler vectors */
+#define IRQ_VECTOR_SVCALL              (11U)
+#define IRQ_VECTOR_PENDSV              (14U)
+#define IRQ_VECTOR_SYSTICK             (15U)
+
+#define IRQ_INITIALIZED                (1U)
+#define IRQ_NOT_INITIALIZED            (0U)
+
+/* Vector of a peripheral interrupt from its IRQ number */
+#define IRQ_VECTOR(IrqNumber)          ((Irq_VectorType)((IrqNumber) + IRQ_FIRST_PERIPHERAL_VECTOR))
+
+/* The NVIC implements the 3 upper bits of the priority bytes: levels 0 (highest) to 7 */
+#define IRQ_PRIORITY_BITS              (3U)
+#define IRQ_PRIORITY_LEVELS            (8U)
+#define IRQ_PRIORITY_BITS_POS          (5U)
+
+/* Priority of the configuration table for a vector Irq_Init does not program: the fixed and
+ * reserved vectors */
+#define IRQ_PRIORITY_UNMANAGED         (0xFFU)
+
+/* Bit of an exclusive area in the ExclusiveAreas mask of the configuration table */
+#define IRQ_EXCLUSIVE_AREA(Area)       ((uint8)(1U << (Area)))
+
+/* Findings of the priority report */
+#define IRQ_FINDING_UNPROTECTED        (0U)   /* shares data guarded by exclusive areas that do not mask it */
+#define IRQ_FINDING_INVERSION          (1U)   /* masked by the exclusive areas while above every ISR using them */
+#define IRQ_FINDING_MISMATCH           (2U)   /* priority changed after Irq_Init, not the one of the table */
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for Irq Init */
+#define IRQ_INIT_SID                   (uint8)0x00
+
+/* Service ID for Irq Register */
+#define IRQ_REGISTER_SID               (uint8)0x01
+
+/* Service ID for Irq Unregister */
+#define IRQ_UNREGISTER_SID             (uint8)0x02
+
+/* Service ID for Irq SetPriority */
+#define IRQ_SET_PRIORITY_SID           (uint8)0x03
+
+/* Service ID for Irq EnableInterrupt */
+#define IRQ_ENABLE_INTERRUPT_SID       (uint8)0x04
+
+/* Service ID for Irq DisableInterrupt */
+#define IRQ_DISABLE_INTERRUPT_SID      (uint8)0x05
+
+/* Service ID for Irq SetPending */
+#define IRQ_SET_PENDING_SID            (uint8)0x06
+
+/* Service ID for Irq ClearPending */
+#define IRQ_CLEAR_PENDING_SID          (uint8)0x07
+
+/* Service ID for Irq CheckPriorities */
+#define IRQ_CHECK_PRIORITIES_SID       (uint8)0x08
+
+/* Service ID for Irq GetPending */
+#define IRQ_GET_PENDING_SID            (uint8)0x09
+
+/* Service ID for Irq GetActive */
+#define IRQ_GET_ACTIVE_SID             (uint8)0x0A
+
+/* Service ID for Irq GetPriority */
+#define IRQ_GET_PRIORITY_SID           (uint8)0x0B
+
+/* Service ID for Irq GetFinding */
+#define IRQ_GET_FINDING_SID            (uint8)0x0C
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* DET code to report a vector that does not exist, is reserved or can not be installed */
+#define IRQ_E_PARAM_VECTOR             (uint8)0x01
+
+/* DET code to report a NULL_PTR handler */
+#define IRQ_E_PARAM_POINTER            (uint8)0x02
+
+/* DET code to report a priority above the implemented levels */
+#define IRQ_E_PARAM_PRIORITY           (uint8)0x03
+
+/* DET code to report an API called before Irq_Init */
+#define IRQ_E_UNINIT                   (uint8)0x04
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for the vector (exception) number used by the Irq APIs */
+typedef uint8 Irq_VectorType;
+
+/* Type definition for the priority level used by the Irq APIs, 0 is the highest */
+typedef uint8 Irq_PriorityType;
+
+/* Type definition for an interrupt service routine */
+typedef void (*Irq_HandlerType)(void);
+
+/* Description: Structure to configure one vector */
+typedef struct
+{
+    /* Priority level programmed by Irq_Init, or IRQ_PRIORITY_UNMANAGED */
+    Irq_PriorityType Priority;
+    /* IRQ_EXCLUSIVE_AREA bits of the exclusive areas guarding the data the ISR shares with
+     * the code using them: the ISR must be masked by these areas */
+    uint8 ExclusiveAreas;
+} Irq_ConfigVector;
+
+/* Data Structure required for initializing the Irq Driver: one entry per vector */
+typedef struct Irq_ConfigType
+{
+    Irq_ConfigVector Vectors[IRQ_VECTOR_COUNT];
+} Irq_ConfigType;
+
+#if (IRQ_PRIORITY_REPORT == STD_ON)
+/* Description: Structure to hold one finding of the priority report */
+typedef struct
+{
+    Irq_VectorType Vector;
+    /* Priority level of the vector in the NVIC */
+    Irq_PriorityType Priority;
+    /* IRQ_FINDING_UNPROTECTED, IRQ_FINDING_INVERSION or IRQ_FINDING_MISMATCH */
+    uint8 Finding;
+} Irq_FindingType;
+#endif
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/*
+ * Description: Set the priority grouping and program the priority of every vector managed by
+ *              the configuration table. Called once from main before the Os starts.
+ */
+void Irq_Init(const Irq_ConfigType * ConfigPtr);
+
+/*
+ * Description: Install Handler in the RAM vector table for Vector and set its priority. The
+ *              vector is called directly by the NVIC, the interrupt itself is enabled by
+ *              the caller. Returns E_NOT_OK for an invalid parameter.
+ */
+Std_ReturnType Irq_Register(Irq_VectorType Vector, Irq_HandlerType Handler, Irq_PriorityType Priority);
+
+/* Description: Put back the handler of the flash vector table for Vector */
+void Irq_Unregister(Irq_VectorType Vector);
+
+/* Description: Set the priority level of a vector, returns E_NOT_OK for an invalid parameter */
+Std_ReturnType Irq_SetPriority(Irq_VectorType Vector, Irq_PriorityType Priority);
+
+/* Description: Get the priority level of a vector from the NVIC (0 for the fixed ones) */
+Irq_PriorityType Irq_GetPriority(Irq_VectorType Vector);
+
+/* Description: Enable a peripheral interrupt in the NVIC */
+void Irq_EnableInterrupt(Irq_VectorType Vector);
+
+/* Description: Disable a peripheral interrupt in the NVIC */
+void Irq_DisableInterrupt(Irq_VectorType Vector);
+
+/* Description: Pend a peripheral interrupt, the PendSV or the SysTick */
+void Irq_SetPending(Irq_VectorType Vector);
+
+/* Description: Clear the pending state of a peripheral interrupt, the PendSV or the SysTick */
+void Irq_ClearPending(Irq_VectorType Vector);
+
+/* Description: Check if a peripheral interrupt, the PendSV or the SysTick is pending */
+boolean Irq_GetPending(Irq_VectorType Vector);
+
+/* Description: Check if a peripheral interrupt is running or preempted by another one */
+boolean Irq_GetActive(Irq_VectorType Vector);
+
+#if (IRQ_PRIORITY_REPORT == STD_ON)
+/*
+ * Description: Check the priorities in the NVIC against the exclusive areas and the table,
+ *              once all the modules are initialized. Returns the number of findings, the
+ *              first IRQ_REPORT_MAX_FINDINGS of them are kept for Irq_GetFinding.
+ */
+uint8 Irq_CheckPriorities(void);
+
+/* Description: Get one finding of the last Irq_CheckPriorities, E_NOT_OK if there is none */
+Std_ReturnType Irq_GetFinding(uint8 Index, Irq_FindingType * Finding);
+
+/* Description: Print the findings of the last Irq_CheckPriorities on the SWO channel (ITM port 0) */
+void Irq_DumpPriorityReport(void);
+#endif
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by Irq and other modules */
+extern const Irq_ConfigType Irq_Configuration;
+
+/* Vector tables of the startup code: the flash one and its RAM copy used through VTOR */
+extern void (* const g_pfnVectors[IRQ_VECTOR_COUNT])(void);
+extern void (*g_pfnRAMVectors[IRQ_VECTOR_COUNT])(void);
+
+#endif /* IRQ_H */
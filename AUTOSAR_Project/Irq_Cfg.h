@@ -0,0 +1,46 @@
+ /******************************************************************************
+ *
+ * Module: Irq
+ *
+ * File Name: Irq_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Irq Driver
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#ifndef IRQ_CFG_H
+#define IRQ_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define IRQ_CFG_SW_MAJOR_VERSION              (1U)
+#define IRQ_CFG_SW_MINOR_VERSION              (0U)
+#define IRQ_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define IRQ_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define IRQ_CFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define IRQ_CFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* Pre-compile option for Development Error Detect */
+#define IRQ_DEV_ERROR_DETECT                (STD_ON)
+
+/*
+ * Number of the priority bits used for the preemption (group) priority (0 - 3), the others are
+ * the subpriority: PRIGROUP is set to 7 - IRQ_PREEMPTION_BITS. Interrupts of the same group do
+ * not preempt each other and BASEPRI masks whole groups.
+ */
+#define IRQ_PREEMPTION_BITS                 (3U)
+
+/* Pre-compile option for the priority report of Irq_CheckPriorities (Irq_GetFinding and
+ * Irq_DumpPriorityReport) */
+#define IRQ_PRIORITY_REPORT                 (STD_ON)
+
+/* Number of the findings kept by the priority report */
+#define IRQ_REPORT_MAX_FINDINGS             (8U)
+
+#endif /* IRQ_CFG_H */
@@ -0,0 +1,241 @@
+ /******************************************************************************
+ *
+ * Module: Irq
+ *
+ * File Name: Irq_PBcfg.c
+ *
+ * Description: Post Build Configuration Source file for TM4C123GH6PM Microcontroller - Irq Driver:
+ *              the priority of every vector and the exclusive areas its ISR shares data with.
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#include "Irq.h"
+#include "Gpt.h"
+#include "Os.h"
+#include "SchM.h"
+
+/*
+ * Module Version 1.0.0
+ */
+#define IRQ_PBCFG_SW_MAJOR_VERSION              (1U)
+#define IRQ_PBCFG_SW_MINOR_VERSION              (0U)
+#define IRQ_PBCFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define IRQ_PBCFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define IRQ_PBCFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define IRQ_PBCFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* AUTOSAR Version checking between Irq_PBcfg.c and Irq.h files */
+#if ((IRQ_PBCFG_AR_RELEASE_MAJOR_VERSION != IRQ_AR_RELEASE_MAJOR_VERSION)\
+ ||  (IRQ_PBCFG_AR_RELEASE_MINOR_VERSION != IRQ_AR_RELEASE_MINOR_VERSION)\
+ ||  (IRQ_PBCFG_AR_RELEASE_PATCH_VERSION != IRQ_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of PBcfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between Irq_PBcfg.c and Irq.h files */
+#if ((IRQ_PBCFG_SW_MAJOR_VERSION != IRQ_SW_MAJOR_VERSION)\
+ ||  (IRQ_PBCFG_SW_MINOR_VERSION != IRQ_SW_MINOR_VERSION)\
+ ||  (IRQ_PBCFG_SW_PATCH_VERSION != IRQ_SW_PATCH_VERSION))
+  #error "The SW version of PBcfg.c does not match the expected version"
+#endif
+
+/* The SysTick and Gpt ISRs share the channel state guarded by the Gpt exclusive area */
+#define IRQ_GPT_AREAS              IRQ_EXCLUSIVE_AREA(SCHM_GPT_EXCLUSIVE_AREA_0)
+
+/*
+ * The Os tasks of the NVIC mode run the application, which calls Dio, Port and Gpt. Their levels
+ * are generated in Os_Cfg.h, the spare IRQs are not used in the other scheduling modes.
+ */
+#if (OS_SCHEDULING_MODE == OS_SCHEDULING_NVIC)
+#define IRQ_OS_TASK_PRIORITY(Slot)  OS_TASK_IRQ_PRIORITY_##Slot
+#define IRQ_OS_TASK_AREAS           (IRQ_EXCLUSIVE_AREA(SCHM_DIO_EXCLUSIVE_AREA_0)\
+                                   | IRQ_EXCLUSIVE_AREA(SCHM_PORT_EXCLUSIVE_AREA_0)\
+                                   | IRQ_EXCLUSIVE_AREA(SCHM_GPT_EXCLUSIVE_AREA_0))
+#else
+#define IRQ_OS_TASK_PRIORITY(Slot)  (7U)
+#define IRQ_OS_TASK_AREAS           (0U)
+#endif
+
+/* Wide Timer 5A is the Os execution budget timer when reserved, it shares nothing with the
+ * exclusive areas. Wide Timer 5B is not used then. */
+#if (GPT_WIDE_TIMER_5_RESERVED == STD_ON)
+#define IRQ_WIDE_TIMER_5A_PRIORITY  OS_BUDGET_IRQ_PRIORITY
+#define IRQ_WIDE_TIMER_5A_AREAS     (0U)
+#define IRQ_WIDE_TIMER_5B_PRIORITY  (7U)
+#define IRQ_WIDE_TIMER_5B_AREAS     (0U)
+#else
+#define IRQ_WIDE_TIMER_5A_PRIORITY  GPT_INTERRUPT_PRIORITY
+#define IRQ_WIDE_TIMER_5A_AREAS     IRQ_GPT_AREAS
+#define IRQ_WIDE_TIMER_5B_PRIORITY  GPT_INTERRUPT_PRIORITY
+#define IRQ_WIDE_TIMER_5B_AREAS     IRQ_GPT_AREAS
+#endif
+
+/*
+ * PB structure used with Irq_Init API: only the fixed and reserved vectors are not programmed.
+ * The faults, SVCall and the debug monitor are at the top, the Os budget timer above the
+ * exclusive areas, SysTick and the Gpt ISRs at the exclusive area level, the Os task IRQs below
+ * and the PendSV and the unused peripherals at the bottom.
+ */
+const Irq_ConfigType Irq_Configuration = {
+    {
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*   0: The initial stack pointer */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*   1: The reset handler */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*   2: The NMI handler */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*   3: The hard fault handler */
+        { 0U, 0 },                                                /*   4: The MPU fault handler */
+        { 0U, 0 },                                                /*   5: The bus fault handler */
+        { 0U, 0 },                                                /*   6: The usage fault handler */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*   7: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*   8: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*   9: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*  10: Reserved */
+        { 0U, 0 },                                                /*  11: SVCall handler */
+        { 0U, 0 },                                                /*  12: Debug monitor handler */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*  13: Reserved */
+        { OS_PENDSV_PRIORITY, 0 },                                /*  14: The PendSV handler */
+        { GPT_SYSTICK_INTERRUPT_PRIORITY, IRQ_GPT_AREAS },        /*  15: The SysTick handler */
+        { 7U, 0 },                                                /*  16: GPIO Port A */
+        { 7U, 0 },                                                /*  17: GPIO Port B */
+        { 7U, 0 },                                                /*  18: GPIO Port C */
+        { 7U, 0 },                                                /*  19: GPIO Port D */
+        { 7U, 0 },                                                /*  20: GPIO Port E */
+        { 7U, 0 },                                                /*  21: UART0 Rx and Tx */
+        { 7U, 0 },                                                /*  22: UART1 Rx and Tx */
+        { 7U, 0 },                                                /*  23: SSI0 Rx and Tx */
+        { 7U, 0 },                                                /*  24: I2C0 Master and Slave */
+        { 7U, 0 },                                                /*  25: PWM Fault */
+        { 7U, 0 },                                                /*  26: PWM Generator 0 */
+        { 7U, 0 },                                                /*  27: PWM Generator 1 */
+        { 7U, 0 },                                                /*  28: PWM Generator 2 */
+        { 7U, 0 },                                                /*  29: Quadrature Encoder 0 */
+        { 7U, 0 },                                                /*  30: ADC Sequence 0 */
+        { 7U, 0 },                                                /*  31: ADC Sequence 1 */
+        { 7U, 0 },                                                /*  32: ADC Sequence 2 */
+        { 7U, 0 },                                                /*  33: ADC Sequence 3 */
+        { 7U, 0 },                                                /*  34: Watchdog timer */
+        { GPT_INTERRUPT_PRIORITY, IRQ_GPT_AREAS },                /*  35: Timer 0 subtimer A */
+        { GPT_INTERRUPT_PRIORITY, IRQ_GPT_AREAS },                /*  36: Timer 0 subtimer B */
+        { GPT_INTERRUPT_PRIORITY, IRQ_GPT_AREAS },                /*  37: Timer 1 subtimer A */
+        { GPT_INTERRUPT_PRIORITY, IRQ_GPT_AREAS },                /*  38: Timer 1 subtimer B */
+        { GPT_INTERRUPT_PRIORITY, IRQ_GPT_AREAS },                /*  39: Timer 2 subtimer A */
+        { GPT_INTERRUPT_PRIORITY, IRQ_GPT_AREAS },                /*  40: Timer 2 subtimer B */
+        { 7U, 0 },                                                /*  41: Analog Comparator 0 */
+        { 7U, 0 },                                                /*  42: Analog Comparator 1 */
+        { 7U, 0 },                                                /*  43: Analog Comparator 2 */
+        { 7U, 0 },                                                /*  44: System Control (PLL, OSC, BO) */
+        { 7U, 0 },                                                /*  45: FLASH Control */
+        { 7U, 0 },                                                /*  46: GPIO Port F */
+        { 7U, 0 },                                                /*  47: GPIO Port G */
+        { 7U, 0 },                                                /*  48: GPIO Port H */
+        { 7U, 0 },                                                /*  49: UART2 Rx and Tx */
+        { 7U, 0 },                                                /*  50: SSI1 Rx and Tx */
+        { GPT_INTERRUPT_PRIORITY, IRQ_GPT_AREAS },                /*  51: Timer 3 subtimer A */
+        { GPT_INTERRUPT_PRIORITY, IRQ_GPT_AREAS },                /*  52: Timer 3 subtimer B */
+        { 7U, 0 },                                                /*  53: I2C1 Master and Slave */
+        { 7U, 0 },                                                /*  54: Quadrature Encoder 1 */
+        { 7U, 0 },                                                /*  55: CAN0 */
+        { 7U, 0 },                                                /*  56: CAN1 */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*  57: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*  58: Reserved */
+        { 7U, 0 },                                                /*  59: Hibernate */
+        { 7U, 0 },                                                /*  60: USB0 */
+        { 7U, 0 },                                                /*  61: PWM Generator 3 */
+        { 7U, 0 },                                                /*  62: uDMA Software Transfer */
+        { 7U, 0 },                                                /*  63: uDMA Error */
+        { 7U, 0 },                                                /*  64: ADC1 Sequence 0 */
+        { 7U, 0 },                                                /*  65: ADC1 Sequence 1 */
+        { 7U, 0 },                                                /*  66: ADC1 Sequence 2 */
+        { 7U, 0 },                                                /*  67: ADC1 Sequence 3 */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*  68: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*  69: Reserved */
+        { 7U, 0 },                                                /*  70: GPIO Port J */
+        { 7U, 0 },                                                /*  71: GPIO Port K */
+        { 7U, 0 },                                                /*  72: GPIO Port L */
+        { IRQ_OS_TASK_PRIORITY(0), IRQ_OS_TASK_AREAS },           /*  73: SSI2 Rx and Tx (Os task 0 in NVIC mode) */
+        { IRQ_OS_TASK_PRIORITY(1), IRQ_OS_TASK_AREAS },           /*  74: SSI3 Rx and Tx (Os task 1 in NVIC mode) */
+        { IRQ_OS_TASK_PRIORITY(2), IRQ_OS_TASK_AREAS },           /*  75: UART3 Rx and Tx (Os task 2 in NVIC mode) */
+        { IRQ_OS_TASK_PRIORITY(3), IRQ_OS_TASK_AREAS },           /*  76: UART4 Rx and Tx (Os task 3 in NVIC mode) */
+        { IRQ_OS_TASK_PRIORITY(4), IRQ_OS_TASK_AREAS },           /*  77: UART5 Rx and Tx (Os task 4 in NVIC mode) */
+        { IRQ_OS_TASK_PRIORITY(5), IRQ_OS_TASK_AREAS },           /*  78: UART6 Rx and Tx (Os task 5 in NVIC mode) */
+        { IRQ_OS_TASK_PRIORITY(6), IRQ_OS_TASK_AREAS },           /*  79: UART7 Rx and Tx (Os task 6 in NVIC mode) */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*  80: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*  81: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*  82: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*  83: Reserved */
+        { 7U, 0 },                                                /*  84: I2C2 Master and Slave */
+        { 7U, 0 },                                                /*  85: I2C3 Master and Slave */
+        { GPT_INTERRUPT_PRIORITY, IRQ_GPT_AREAS },                /*  86: Timer 4 subtimer A */
+        { GPT_INTERRUPT_PRIORITY, IRQ_GPT_AREAS },                /*  87: Timer 4 subtimer B */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*  88: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*  89: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*  90: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*  91: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*  92: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*  93: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*  94: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*  95: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*  96: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*  97: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*  98: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /*  99: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /* 100: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /* 101: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /* 102: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /* 103: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /* 104: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /* 105: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /* 106: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /* 107: Reserved */
+        { GPT_INTERRUPT_PRIORITY, IRQ_GPT_AREAS },                /* 108: Timer 5 subtimer A */
+        { GPT_INTERRUPT_PRIORITY, IRQ_GPT_AREAS },                /* 109: Timer 5 subtimer B */
+        { GPT_INTERRUPT_PRIORITY, IRQ_GPT_AREAS },                /* 110: Wide Timer 0 subtimer A */
+        { GPT_INTERRUPT_PRIORITY, IRQ_GPT_AREAS },                /* 111: Wide Timer 0 subtimer B */
+        { GPT_INTERRUPT_PRIORITY, IRQ_GPT_AREAS },                /* 112: Wide Timer 1 subtimer A */
+        { GPT_INTERRUPT_PRIORITY, IRQ_GPT_AREAS },                /* 113: Wide Timer 1 subtimer B */
+        { GPT_INTERRUPT_PRIORITY, IRQ_GPT_AREAS },                /* 114: Wide Timer 2 subtimer A */
+        { GPT_INTERRUPT_PRIORITY, IRQ_GPT_AREAS },                /* 115: Wide Timer 2 subtimer B */
+        { GPT_INTERRUPT_PRIORITY, IRQ_GPT_AREAS },                /* 116: Wide Timer 3 subtimer A */
+        { GPT_INTERRUPT_PRIORITY, IRQ_GPT_AREAS },                /* 117: Wide Timer 3 subtimer B */
+        { GPT_INTERRUPT_PRIORITY, IRQ_GPT_AREAS },                /* 118: Wide Timer 4 subtimer A */
+        { GPT_INTERRUPT_PRIORITY, IRQ_GPT_AREAS },                /* 119: Wide Timer 4 subtimer B */
+        { IRQ_WIDE_TIMER_5A_PRIORITY, IRQ_WIDE_TIMER_5A_AREAS },  /* 120: Wide Timer 5 subtimer A (Os budget timer) */
+        { IRQ_WIDE_TIMER_5B_PRIORITY, IRQ_WIDE_TIMER_5B_AREAS },  /* 121: Wide Timer 5 subtimer B */
+        { 7U, 0 },                                                /* 122: FPU */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /* 123: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /* 124: Reserved */
+        { 7U, 0 },                                                /* 125: I2C4 Master and Slave */
+        { 7U, 0 },                                                /* 126: I2C5 Master and Slave */
+        { 7U, 0 },                                                /* 127: GPIO Port M */
+        { 7U, 0 },                                                /* 128: GPIO Port N */
+        { 7U, 0 },                                                /* 129: Quadrature Encoder 2 */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /* 130: Reserved */
+        { IRQ_PRIORITY_UNMANAGED, 0 },                            /* 131: Reserved */
+        { 7U, 0 },                                                /* 132: GPIO Port P (Summary or P0) */
+        { 7U, 0 },                                                /* 133: GPIO Port P1 */
+        { 7U, 0 },                                                /* 134: GPIO Port P2 */
+        { 7U, 0 },                                                /* 135: GPIO Port P3 */
+        { 7U, 0 },                                                /* 136: GPIO Port P4 */
+        { 7U, 0 },                                                /* 137: GPIO Port P5 */
+        { 7U, 0 },                                                /* 138: GPIO Port P6 */
+        { 7U, 0 },                                                /* 139: GPIO Port P7 */
+        { 7U, 0 },                                                /* 140: GPIO Port Q (Summary or Q0) */
+        { 7U, 0 },                                                /* 141: GPIO Port Q1 */
+        { 7U, 0 },                                                /* 142: GPIO Port Q2 */
+        { 7U, 0 },                                                /* 143: GPIO Port Q3 */
+        { 7U, 0 },                                                /* 144: GPIO Port Q4 */
+        { 7U, 0 },                                                /* 145: GPIO Port Q5 */
+        { 7U, 0 },                                                /* 146: GPIO Port Q6 */
+        { 7U, 0 },                                                /* 147: GPIO Port Q7 */
+        { 7U, 0 },                                                /* 148: GPIO Port R */
+        { 7U, 0 },                                                /* 149: GPIO Port S */
+        { 7U, 0 },                                                /* 150: PWM 1 Generator 0 */
+        { 7U, 0 },                                                /* 151: PWM 1 Generator 1 */
+        { 7U, 0 },                                                /* 152: PWM 1 Generator 2 */
+        { 7U, 0 },                                                /* 153: PWM 1 Generator 3 */
+        { 7U, 0 }                                                 /* 154: PWM 1 Fault */
+    }
+};
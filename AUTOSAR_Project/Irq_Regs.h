@@ -0,0 +1,50 @@
+ /******************************************************************************
+ *
+ * Module: Irq
+ *
+ * File Name: Irq_Regs.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Irq Driver Registers
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#ifndef IRQ_REGS_H
+#define IRQ_REGS_H
+
+#include "Std_Types.h"
+
+/* Vector Table Offset Register: address of the vector table in use */
+#define IRQ_VTABLE_REG                   (*((volatile uint32 *)0xE000ED08))
+
+/* Interrupt Control and State Register: pend / clear of the PendSV and SysTick exceptions */
+#define IRQ_INTCTRL_REG                  (*((volatile uint32 *)0xE000ED04))
+
+/* Application Interrupt and Reset Control Register: priority grouping (PRIGROUP) */
+#define IRQ_APINT_REG                    (*((volatile uint32 *)0xE000ED0C))
+
+/* Enable, disable, pend, unpend and active registers of the peripheral interrupts, one bit per IRQ */
+#define IRQ_NVIC_EN_BASE_ADDRESS         ((volatile uint32 *)0xE000E100)
+#define IRQ_NVIC_DIS_BASE_ADDRESS        ((volatile uint32 *)0xE000E180)
+#define IRQ_NVIC_PEND_BASE_ADDRESS       ((volatile uint32 *)0xE000E200)
+#define IRQ_NVIC_UNPEND_BASE_ADDRESS     ((volatile uint32 *)0xE000E280)
+#define IRQ_NVIC_ACTIVE_BASE_ADDRESS     ((volatile uint32 *)0xE000E300)
+
+/* Priority bytes of the peripheral interrupts, one byte per IRQ from IRQ 0 */
+#define IRQ_NVIC_PRI_BASE_ADDRESS        ((volatile uint8 *)0xE000E400)
+
+/* Priority bytes of the system handlers, one byte per exception from the MPU fault (4) */
+#define IRQ_SYSTEM_PRI_BASE_ADDRESS      ((volatile uint8 *)0xE000ED18)
+
+/* APINT fields: the write key and PRIGROUP */
+#define IRQ_APINT_VECTKEY                0x05FA0000
+#define IRQ_APINT_PRIGROUP_POS           8
+#define IRQ_APINT_PRIGROUP_MASK          0x00000700
+
+/* INTCTRL bits to pend / clear the PendSV and SysTick exceptions */
+#define IRQ_INTCTRL_PENDSVSET_MASK       0x10000000
+#define IRQ_INTCTRL_PENDSVCLR_MASK       0x08000000
+#define IRQ_INTCTRL_PENDSTSET_MASK       0x04000000
+#define IRQ_INTCTRL_PENDSTCLR_MASK       0x02000000
+
+#endif /* IRQ_REGS_H */
@@ -11,29 +11,40 @@
 #include "Dio.h"
 #include "Led.h"
 
+/* Level requested by Led_SetOn, Led_SetOff and Led_Toggle */
+static Dio_LevelType g_led_level = LED_OFF;
+
+/* Level computed by the last Led_RefreshOutput, written to the pin by Led_CommitOutput */
+static Dio_LevelType g_led_output = LED_OFF;
+
 /*********************************************************************************************/
 void Led_SetOn(void)
 {
-    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,LED_ON);  /* LED ON */
+    g_led_level = LED_ON;  /* LED ON */
 }
 
 /*********************************************************************************************/
 void Led_SetOff(void)
 {
-    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,LED_OFF); /* LED OFF */
+    g_led_level = LED_OFF; /* LED OFF */
 }
 
 /*********************************************************************************************/
 void Led_RefreshOutput(void)
 {
-    Dio_LevelType state = Dio_ReadChannel(DioConf_LED1_CHANNEL_ID_INDEX);
-    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,state); /* re-write the same value */
+    g_led_output = g_led_level;
+}
+
+/*********************************************************************************************/
+void Led_CommitOutput(void)
+{
+    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,g_led_output); /* re-write the pin every period */
 }
 
 /*********************************************************************************************/
 void Led_Toggle(void)
 {
-    Dio_LevelType state = Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX);
+    g_led_level = (g_led_level == LED_ON) ? LED_OFF : LED_ON;
 }
 
 /*********************************************************************************************/
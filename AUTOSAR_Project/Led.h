@@ -24,7 +24,10 @@ void Led_SetOff(void);
 /*Description: Toggle the LED state */
 void Led_Toggle(void);
 
-/* Description: Refresh the LED state */
+/* Description: Compute the LED output from the requested state */
 void Led_RefreshOutput(void);
 
+/* Description: Write the output computed by the last Led_RefreshOutput to the LED pin */
+void Led_CommitOutput(void);
+
 #endif /* LED_H */
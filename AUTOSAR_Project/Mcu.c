@@ -9,11 +9,113 @@
  * Author: Mohannad Sabry
  ******************************************************************************/
 
+#include "Mcu.h"
 #include "tm4c123gh6pm_registers.h"
 
+/* RCC fields */
+#define MCU_RCC_XTAL_POS            6
+#define MCU_RCC_XTAL_MASK           0x000007C0
+#define MCU_RCC_OSCSRC_POS          4
+#define MCU_RCC_OSCSRC_MASK         0x00000030
+#define MCU_RCC_BYPASS_MASK         0x00000800
+#define MCU_RCC_USESYSDIV_MASK      0x00400000
+#define MCU_RCC_SYSDIV_POS          23
+#define MCU_RCC_SYSDIV_MASK         0x07800000
+
+/* RCC2 fields, they replace the RCC ones when USERCC2 is set */
+#define MCU_RCC2_USERCC2_MASK       0x80000000
+#define MCU_RCC2_DIV400_MASK        0x40000000
+#define MCU_RCC2_SYSDIV2_POS        23
+#define MCU_RCC2_SYSDIV2_MASK       0x1F800000
+#define MCU_RCC2_SYSDIV2LSB_MASK    0x00400000
+#define MCU_RCC2_BYPASS2_MASK       0x00000800
+#define MCU_RCC2_OSCSRC2_POS        4
+#define MCU_RCC2_OSCSRC2_MASK       0x00000070
+
+/* Oscillator sources of the OSCSRC/OSCSRC2 fields */
+#define MCU_OSCSRC_MAIN             0
+#define MCU_OSCSRC_PIOSC            1
+#define MCU_OSCSRC_PIOSC_DIV_4      2
+#define MCU_OSCSRC_LFIOSC           3
+#define MCU_OSCSRC_32768HZ          7
+
+/* Clock frequencies in Hz */
+#define MCU_PIOSC_HZ                16000000U
+#define MCU_LFIOSC_HZ               30000U
+#define MCU_HIBERNATION_OSC_HZ      32768U
+#define MCU_PLL_HZ                  400000000U
+
+/* Main oscillator crystal of every XTAL value from 0x06 (4 MHz) to 0x1A (25 MHz) */
+static const uint32 Mcu_Crystal_Hz[] = {
+    4000000U, 4096000U, 4915200U, 5000000U, 5120000U, 6000000U, 6144000U, 7372800U, 8000000U,
+    8192000U, 10000000U, 12000000U, 12288000U, 13560000U, 14318180U, 16000000U, 16384000U,
+    18000000U, 20000000U, 24000000U, 25000000U
+};
+#define MCU_XTAL_FIRST              0x06
+
 void Mcu_Init(void)
 {
     /* Enable clock for All PORTs and wait for clock to start */
     SYSCTL_RCGCGPIO_REG |= 0x3F;
     while(!(SYSCTL_PRGPIO_REG & 0x3F));
 }
+
+uint32 Mcu_GetCoreClockHz(void)
+{
+    uint32 Rcc  = SYSCTL_RCC_REG;
+    uint32 Rcc2 = SYSCTL_RCC2_REG;
+    uint32 Use_Rcc2 = Rcc2 & MCU_RCC2_USERCC2_MASK;
+    uint32 Oscsrc = Use_Rcc2 ? ((Rcc2 & MCU_RCC2_OSCSRC2_MASK) >> MCU_RCC2_OSCSRC2_POS)
+                             : ((Rcc & MCU_RCC_OSCSRC_MASK) >> MCU_RCC_OSCSRC_POS);
+    uint32 Bypass = Use_Rcc2 ? (Rcc2 & MCU_RCC2_BYPASS2_MASK) : (Rcc & MCU_RCC_BYPASS_MASK);
+    uint32 Xtal = (Rcc & MCU_RCC_XTAL_MASK) >> MCU_RCC_XTAL_POS;
+    uint32 Clock_Hz;
+    uint32 Divisor;
+
+    if(Bypass == 0)
+    {
+        /* The PLL runs at 400 MHz whatever its reference, divided by 2 unless DIV400 is used */
+        Clock_Hz = (Use_Rcc2 && (Rcc2 & MCU_RCC2_DIV400_MASK)) ? MCU_PLL_HZ : (MCU_PLL_HZ / 2U);
+    }
+    else
+    {
+        switch(Oscsrc)
+        {
+            case MCU_OSCSRC_MAIN:
+                Clock_Hz = ((Xtal >= MCU_XTAL_FIRST) && ((Xtal - MCU_XTAL_FIRST) < (sizeof(Mcu_Crystal_Hz) / sizeof(Mcu_Crystal_Hz[0]))))
+                           ? Mcu_Crystal_Hz[Xtal - MCU_XTAL_FIRST] : MCU_PIOSC_HZ;
+                break;
+            case MCU_OSCSRC_PIOSC_DIV_4:
+                Clock_Hz = MCU_PIOSC_HZ / 4U;
+                break;
+            case MCU_OSCSRC_LFIOSC:
+                Clock_Hz = MCU_LFIOSC_HZ;
+                break;
+            case MCU_OSCSRC_32768HZ:
+                Clock_Hz = MCU_HIBERNATION_OSC_HZ;
+                break;
+            default:
+                Clock_Hz = MCU_PIOSC_HZ;
+                break;
+        }
+    }
+
+    if(Rcc & MCU_RCC_USESYSDIV_MASK)
+    {
+        if(Use_Rcc2 && (Rcc2 & MCU_RCC2_DIV400_MASK) && (Bypass == 0))
+        {
+            /* 7-bit divisor of the 400 MHz PLL output */
+            Divisor = ((Rcc2 & (MCU_RCC2_SYSDIV2_MASK | MCU_RCC2_SYSDIV2LSB_MASK)) >> (MCU_RCC2_SYSDIV2_POS - 1U)) + 1U;
+        }
+        else if(Use_Rcc2)
+        {
+            Divisor = ((Rcc2 & MCU_RCC2_SYSDIV2_MASK) >> MCU_RCC2_SYSDIV2_POS) + 1U;
+        }
+        else
+        {
+            Divisor = ((Rcc & MCU_RCC_SYSDIV_MASK) >> MCU_RCC_SYSDIV_POS) + 1U;
+        }
+        Clock_Hz /= Divisor;
+    }
+    return Clock_Hz;
+}
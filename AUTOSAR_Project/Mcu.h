@@ -17,4 +17,10 @@
 
 void Mcu_Init(void);
 
+/*
+ * Description: Get the frequency of the core clock (and the SysTick and timer clocks) in Hz,
+ *              decoded from the clock source, PLL and divider settings of RCC/RCC2.
+ */
+uint32 Mcu_GetCoreClockHz(void);
+
 #endif /* MCU_H_ */
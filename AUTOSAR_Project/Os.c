@@ -10,32 +10,80 @@
  ******************************************************************************/
 
 #include "Os.h"
+#include "Os_Kernel.h"
+#include "Os_Trace.h"
 #include "App.h"
-#include "Button.h"
-#include "Led.h"
 #include "Gpt.h"
 
-/* Enable Exceptions ... This Macro enable IRQ interrupts, Programmable Systems Exceptions and Faults by clearing the I-bit in the PRIMASK. */
-#define Enable_Exceptions()    __asm(" CPSIE I ")
+/* Global variable store the Os Time: the current tick inside the schedule hyperperiod */
+static uint16 g_Time_Tick_Count = 0;
 
-/* Disable Exceptions ... This Macro disable IRQ interrupts, Programmable Systems Exceptions and Faults by setting the I-bit in the PRIMASK. */
-#define Disable_Exceptions()   __asm(" CPSID I ")
+/* Number of ticks counted by the timer interrupt since the Os started, only written by the ISR
+ * (and by the tickless idle while the interrupts are disabled) */
+static volatile uint32 g_Tick_Counter = 0;
 
-/* Enable Faults ... This Macro enable Faults by clearing the F-bit in the FAULTMASK */
-#define Enable_Faults()        __asm(" CPSIE F ")
+/* Upper 32 bits of the tick counter, incremented when g_Tick_Counter wraps around */
+static volatile uint32 g_Tick_Counter_High = 0;
 
-/* Disable Faults ... This Macro disable Faults by setting the F-bit in the FAULTMASK */
-#define Disable_Faults()       __asm(" CPSID F ")
+/* Number of ticks already processed by the scheduler, the backlog is g_Tick_Counter - g_Processed_Ticks */
+static uint32 g_Processed_Ticks = 0;
 
-/* Global variable store the Os Time */
-static uint8 g_Time_Tick_Count = 0;
+/* Schedule run by the scheduler, only replaced at the end of its hyperperiod */
+static const Os_ScheduleTableType * g_Schedule = &Os_Configuration.Schedules[0];
 
-/* Global variable to indicate the the timer has a new tick */
-static uint8 g_New_Time_Tick_Flag = 0;
+/* Schedule requested by Os_SwitchSchedule */
+static volatile Os_ScheduleType g_Requested_Schedule = 0;
+
+/* Schedule started on the last hyperperiod boundary and the tick counter value of that boundary */
+static Os_ScheduleType g_Boundary_Schedule = 0;
+static uint32 g_Boundary_Tick = 0;
+
+/* Index of the next expiry point of the schedule to be reached */
+static uint16 g_Expiry_Point_Index = 0;
+
+/* Number of ticks that could not be processed on time */
+static uint32 g_Lost_Tick_Count = 0;
+
+/* Number of times each task was still running when the next tick expired */
+static uint32 g_Task_Overrun_Count[OS_TASK_COUNT];
+
+/* Number of activations of each task that were started late or skipped */
+static uint32 g_Task_Late_Activation_Count[OS_TASK_COUNT];
+
+/* Cooperative mode: one bit per task activated by Os_ActivateTask and not started yet
+ * (the preemptive kernels keep the activations themselves, it stays 0 there) */
+static volatile uint32 g_Event_Activations = 0;
+
+/* Cooperative mode: task being executed by the scheduler loop, OS_TASK_COUNT in between */
+static Os_TaskType g_Running_Task = OS_TASK_COUNT;
+
+static void Os_ProcessTick(boolean Late);
+#if (OS_SCHEDULING_MODE == OS_SCHEDULING_COOPERATIVE)
+static void Os_RunTask(Os_TaskType TaskId, boolean Late);
+static void Os_RunEventTask(void);
+#endif
+#if (OS_TICK_OVERRUN_MODE == OS_OVERRUN_SKIP) && (OS_SCHEDULING_MODE == OS_SCHEDULING_COOPERATIVE)
+static void Os_SkipTick(void);
+#endif
+#if (OS_TICKLESS_IDLE == STD_ON)
+static void Os_Idle(void);
+#endif
+#if (OS_SCHEDULING_MODE != OS_SCHEDULING_COOPERATIVE)
+static void Os_IdleLoop(void);
+#endif
 
 /*********************************************************************************************/
 void Os_start(void)
 {
+#if (OS_TIMESTAMPS == STD_ON)
+    /* Start the cycle counter used to measure the task execution times and the CPU load and to trace */
+    Os_TimingInit();
+#endif
+
+#if (OS_RESOURCE_COUNT > 0U)
+    Os_ResourceInit();
+#endif
+
     /* Global Interrupts Enable */
     Enable_Exceptions();
     
@@ -45,8 +93,21 @@ void Os_start(void)
      */
     SysTick_SetCallBack(Os_NewTimerTick);
 
-    /* Start SysTickTimer to generate interrupt every 20ms */
-    SysTick_Start(OS_BASE_TIME);
+    /* Start SysTickTimer to generate interrupt every 20ms (the tick time is given in us) */
+    SysTick_Start(OS_BASE_TIME * 1000U);
+
+#if (OS_TIMING_PROTECTION == STD_ON)
+    /* Start the budget timer of the tasks */
+    Os_ProtectionInit();
+#endif
+
+#if (OS_APERIODIC_SERVER == STD_ON)
+    Os_ServerInit();
+#endif
+
+#if (OS_TRACE == STD_ON)
+    Os_TraceInit();
+#endif
 
     /* Execute the Init Task */
     Init_Task();
@@ -58,49 +119,516 @@ void Os_start(void)
 /*********************************************************************************************/
 void Os_NewTimerTick(void)
 {
-    /* Increment the Os time by OS_BASE_TIME */
-    g_Time_Tick_Count   += OS_BASE_TIME;
+    /* Count the new tick, the scheduler processes all the ticks it has not seen yet */
+    g_Tick_Counter++;
+    if(g_Tick_Counter == 0)
+    {
+        g_Tick_Counter_High++;
+    }
+
+#if (OS_LET == STD_ON)
+    /* First thing on the tick so the outputs are published with the ISR latency as only jitter */
+    Os_LetTick(g_Tick_Counter);
+#endif
 
-    /* Set the flag to 1 to indicate that there is a new timer tick */
-    g_New_Time_Tick_Flag = 1;
+#if (OS_CPU_LOAD_MEASUREMENT == STD_ON)
+    /* Close the load measurement of the elapsed tick interval */
+    Os_CpuLoadTick(Os_TimingGetTimestamp(), g_Tick_Counter);
+#endif
+
+#if (OS_STACK_MONITORING == STD_ON)
+    /* Stop before a stack overflow corrupts the data below it */
+    Os_StackCheck();
+#endif
+
+#if (OS_ALARMS == STD_ON)
+    /* Expire the alarms of the new tick(s), their callbacks run in Os_AlarmTask */
+    Os_AlarmTick(g_Tick_Counter);
+#endif
+
+#if (OS_APERIODIC_SERVER == STD_ON)
+    /* Replenish the aperiodic server budget, an exhausted server with jobs is activated again */
+    Os_ServerTick(g_Tick_Counter);
+#endif
+
+#if (OS_SCHEDULING_MODE != OS_SCHEDULING_COOPERATIVE)
+    /* The tick is processed right away in the ISR, it only activates the due tasks
+     * and they preempt the idle loop by priority after the ISR returns */
+    Os_ProcessTick(FALSE);
+#endif
+#if (OS_SCHEDULING_MODE == OS_SCHEDULING_PREEMPTIVE)
+    Os_KernelDispatch();
+#endif
 }
 
 /*********************************************************************************************/
 void Os_Scheduler(void)
 {
+#if (OS_SCHEDULING_MODE != OS_SCHEDULING_COOPERATIVE)
+    /* The tasks are dispatched by the kernel, this context becomes the idle loop */
+    Os_KernelStart(Os_IdleLoop);
+#else
+    uint32 Pending_Ticks;
+
     while(1)
     {
-	/* Code is only executed in case there is a new timer tick */
-	if(g_New_Time_Tick_Flag == 1)
-	{
-	    switch(g_Time_Tick_Count)
+        Pending_Ticks = g_Tick_Counter - g_Processed_Ticks;
+
+        /* Code is only executed in case there is a new timer tick */
+        if(Pending_Ticks > 0)
+        {
+#if (OS_CPU_LOAD_MEASUREMENT == STD_ON)
+            Os_KernelIdleEnd();
+#endif
+#if (OS_TICK_OVERRUN_MODE == OS_OVERRUN_SKIP)
+            /* Drop the activations of all the late ticks except the latest one */
+            while(Pending_Ticks > 1)
+            {
+                Os_SkipTick();
+                Pending_Ticks--;
+                g_Lost_Tick_Count++;
+            }
+            Os_ProcessTick(FALSE);
+#else
+            if(Pending_Ticks > 1)
+            {
+                /* The previous ticks took too long, this tick is processed late */
+                g_Lost_Tick_Count++;
+            }
+
+            /* Catch up the late ticks one by one in the original order */
+            Os_ProcessTick((boolean)(Pending_Ticks > 1));
+#endif
+        }
+        else if(g_Event_Activations != 0)
+        {
+#if (OS_CPU_LOAD_MEASUREMENT == STD_ON)
+            Os_KernelIdleEnd();
+#endif
+            /* The ticks have precedence, the event tasks run in between */
+            Os_RunEventTask();
+        }
+        else
+        {
+#if (OS_CPU_LOAD_MEASUREMENT == STD_ON)
+            /* Nothing to process: the scheduler is idle until the next tick */
+            Os_KernelIdleStart();
+#endif
+#if (OS_TICKLESS_IDLE == STD_ON)
+            Os_Idle();
+#endif
+        }
+    }
+#endif /* (OS_SCHEDULING_MODE != OS_SCHEDULING_COOPERATIVE) */
+}
+
+#if (OS_SCHEDULING_MODE != OS_SCHEDULING_COOPERATIVE)
+/*********************************************************************************************/
+static void Os_IdleLoop(void)
+{
+    /* Lowest priority context, runs whenever no task is ready */
+    while(1)
+    {
+#if (OS_CPU_LOAD_MEASUREMENT == STD_ON)
+        /* Back in the idle loop: the preempting tasks ended their idle period on start */
+        Os_KernelIdleStart();
+#endif
+#if (OS_TICKLESS_IDLE == STD_ON)
+        Os_Idle();
+#endif
+    }
+}
+#endif
+
+/*********************************************************************************************/
+Std_ReturnType Os_ActivateTask(Os_TaskType TaskId)
+{
+    Std_ReturnType Status;
+    uint32 Primask;
+
+    if(TaskId >= OS_TASK_COUNT)
+    {
+        return E_NOT_OK;
+    }
+
+    /* Also called from ISRs, the interrupt state of the caller is kept */
+    Primask = Os_CpuSaveAndDisable();
+    Status  = Os_KernelActivateEvent(TaskId);
+    Os_CpuRestore(Primask);
+    return Status;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_KernelActivateEvent(Os_TaskType TaskId)
+{
+#if (OS_SCHEDULING_MODE == OS_SCHEDULING_COOPERATIVE)
+    /* Also reached unmasked from the SysTick ISR, a higher ISR must not activate in between */
+    uint32 Primask = Os_CpuSaveAndDisable();
+
+    if(g_Event_Activations & ((uint32)1 << TaskId))
+    {
+        Os_CpuRestore(Primask);
+        return E_NOT_OK;
+    }
+    g_Event_Activations |= (uint32)1 << TaskId;
+#if (OS_TIMING_PROTECTION == STD_ON)
+    Os_ProtectionActivate(TaskId, g_Tick_Counter);
+#endif
+    Os_CpuRestore(Primask);
+    return E_OK;
+#else
+    Std_ReturnType Status = Os_KernelActivateTask(TaskId);
+#if (OS_SCHEDULING_MODE == OS_SCHEDULING_PREEMPTIVE)
+    Os_KernelDispatch();
+#endif
+    return Status;
+#endif
+}
+
+/*********************************************************************************************/
+uint64 Os_GetTicks(void)
+{
+    uint32 Primask = Os_CpuSaveAndDisable();
+    uint64 Ticks = ((uint64)g_Tick_Counter_High << 32) | g_Tick_Counter;
+
+    Os_CpuRestore(Primask);
+    return Ticks;
+}
+
+/*********************************************************************************************/
+uint64 Os_GetTimeUs(void)
+{
+    uint32 Primask;
+    uint64 Ticks;
+    uint32 Cycles;
+
+    /* The tick counter and the SysTick counter are read together, a tick expired meanwhile is
+     * still pending and counted in Cycles instead */
+    Primask = Os_CpuSaveAndDisable();
+    Ticks   = ((uint64)g_Tick_Counter_High << 32) | g_Tick_Counter;
+    Cycles  = SysTick_GetElapsedCycles();
+    Os_CpuRestore(Primask);
+
+    return (Ticks * (OS_BASE_TIME * 1000ULL)) + (((uint64)Cycles * (OS_BASE_TIME * 1000U)) / SysTick_GetTickCycles());
+}
+
+/*********************************************************************************************/
+uint32 Os_GetTaskOverrunCount(Os_TaskType TaskId)
+{
+    uint32 Count = 0;
+
+    if(TaskId < OS_TASK_COUNT)
+    {
+        Count = g_Task_Overrun_Count[TaskId];
+    }
+    return Count;
+}
+
+/*********************************************************************************************/
+uint32 Os_GetTaskLateActivationCount(Os_TaskType TaskId)
+{
+    uint32 Count = 0;
+
+    if(TaskId < OS_TASK_COUNT)
+    {
+        Count = g_Task_Late_Activation_Count[TaskId];
+    }
+    return Count;
+}
+
+/*********************************************************************************************/
+uint32 Os_GetLostTickCount(void)
+{
+    return g_Lost_Tick_Count;
+}
+
+/*********************************************************************************************/
+const Os_ScheduleTableType * Os_KernelGetBoundarySchedule(uint32 Tick)
+{
+    uint32 Primask = Os_CpuSaveAndDisable();
+
+    /* The scheduler lags the LET ticks by less than one hyperperiod, the second caller finds the boundary taken */
+    if(Tick != g_Boundary_Tick)
+    {
+        g_Boundary_Tick     = Tick;
+        g_Boundary_Schedule = g_Requested_Schedule;
+    }
+    Os_CpuRestore(Primask);
+    return &Os_Configuration.Schedules[g_Boundary_Schedule];
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_SwitchSchedule(Os_ScheduleType ScheduleId)
+{
+    if(ScheduleId >= OS_SCHEDULE_COUNT)
+    {
+        return E_NOT_OK;
+    }
+    g_Requested_Schedule = ScheduleId;
+    return E_OK;
+}
+
+/*********************************************************************************************/
+Os_ScheduleType Os_GetSchedule(void)
+{
+    return (Os_ScheduleType)(g_Schedule - Os_Configuration.Schedules);
+}
+
+/*********************************************************************************************/
+uint32 Os_KernelGetTickCounter(void)
+{
+    return g_Tick_Counter;
+}
+
+#if (OS_SCHEDULING_MODE == OS_SCHEDULING_COOPERATIVE)
+/*********************************************************************************************/
+Os_TaskType Os_KernelGetRunningTask(void)
+{
+    return g_Running_Task;
+}
+#endif
+
+/*********************************************************************************************/
+static void Os_NextTick(void)
+{
+    /* Move to the next tick and start the schedule again at the end of the hyperperiod */
+    g_Time_Tick_Count++;
+    if(g_Time_Tick_Count == g_Schedule->Hyperperiod)
+    {
+        /* The only place the schedule changes, the dispatch of every tick never checks for a switch */
+        g_Time_Tick_Count = 0;
+        g_Schedule = Os_KernelGetBoundarySchedule(g_Processed_Ticks + 2U);
+    }
+    g_Processed_Ticks++;
+}
+
+/*********************************************************************************************/
+static void Os_ProcessTick(boolean Late)
+{
+    const Os_ScheduleTableType * Schedule = g_Schedule;
+    const Os_ExpiryPointType * ExpiryPoint = &Schedule->ExpiryPoints[g_Expiry_Point_Index];
+    Os_TaskType TaskId;
+    uint16 TaskIndex;
+
+    /* Expiry points are sorted by offset, so only the next one can be due on this tick */
+    if(ExpiryPoint->Offset == g_Time_Tick_Count)
+    {
+        /* The task list of this expiry point ends where the next one starts */
+        for(TaskIndex = ExpiryPoint->FirstTask; TaskIndex < (ExpiryPoint + 1)->FirstTask; TaskIndex++)
+        {
+            TaskId = Schedule->ExpiryTasks[TaskIndex];
+#if (OS_TIMING_PROTECTION == STD_ON)
+            if(Os_ProtectionSkipActivation(TaskId))
+            {
+                /* Dropped on request of the protection hook */
+                continue;
+            }
+#endif
+#if (OS_SCHEDULING_MODE != OS_SCHEDULING_COOPERATIVE)
+            if(Os_KernelActivateTask(TaskId) != E_OK)
             {
-		case 20:
-		case 100:
-			    Button_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 40:
-		case 80:
-			    Button_Task();
-			    Led_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 60:
-			    Button_Task();
-			    App_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 120:
-			    Button_Task();
-			    App_Task();
-			    Led_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    g_Time_Tick_Count = 0;
-			    break;
+                /* The task did not finish before its next activation */
+                g_Task_Overrun_Count[TaskId]++;
             }
-	}
+#else
+#if (OS_TIMING_PROTECTION == STD_ON)
+            Os_ProtectionActivate(TaskId, g_Processed_Ticks + 1U);
+#endif
+            Os_RunTask(TaskId, Late);
+#endif
+        }
+
+        g_Expiry_Point_Index++;
+        if(g_Expiry_Point_Index == Schedule->ExpiryPointCount)
+        {
+            g_Expiry_Point_Index = 0;
+        }
     }
 
+    Os_NextTick();
+}
+
+#if (OS_SCHEDULING_MODE == OS_SCHEDULING_COOPERATIVE)
+/*********************************************************************************************/
+static void Os_RunTask(Os_TaskType TaskId, boolean Late)
+{
+    uint32 Tick_Counter;
+#if (OS_EXECUTION_TIME_MEASUREMENT == STD_ON)
+    Os_TimingContextType Timing;
+#endif
+#if (OS_TIMING_PROTECTION == STD_ON)
+    Os_ProtectionContextType Protection;
+#endif
+
+    if(Late)
+    {
+        g_Task_Late_Activation_Count[TaskId]++;
+    }
+
+    Tick_Counter = g_Tick_Counter;
+    g_Running_Task = TaskId;
+    OS_TRACE_TASK_START(TaskId);
+#if (OS_TIMING_PROTECTION == STD_ON)
+    Os_ProtectionTaskStart(TaskId, &Protection);
+#endif
+#if (OS_EXECUTION_TIME_MEASUREMENT == STD_ON)
+    Os_TimingStart(&Timing);
+    Os_Configuration.Tasks[TaskId].Entry();
+    Os_TimingStop(TaskId, &Timing);
+#else
+    Os_Configuration.Tasks[TaskId].Entry();
+#endif
+#if (OS_TIMING_PROTECTION == STD_ON)
+    Os_ProtectionTaskEnd(TaskId, &Protection);
+#endif
+#if (OS_LET == STD_ON)
+    Os_LetTaskEnd(TaskId);
+#endif
+#if (OS_RESOURCE_COUNT > 0U)
+    Os_ResourceTaskEnd(TaskId);
+#endif
+    OS_TRACE_TASK_END(TaskId);
+    g_Running_Task = OS_TASK_COUNT;
+    if(g_Tick_Counter != Tick_Counter)
+    {
+        /* The task did not finish inside the tick it was started in */
+        g_Task_Overrun_Count[TaskId]++;
+    }
+}
+
+/*********************************************************************************************/
+static void Os_RunEventTask(void)
+{
+    Os_TaskType TaskId;
+    Os_TaskType Next = OS_TASK_COUNT;
+    uint32 Primask;
+
+    /* Highest priority activated task */
+    for(TaskId = 0; TaskId < OS_TASK_COUNT; TaskId++)
+    {
+        if((g_Event_Activations & ((uint32)1 << TaskId)) &&
+           ((Next == OS_TASK_COUNT) || (Os_Configuration.Tasks[TaskId].Priority > Os_Configuration.Tasks[Next].Priority)))
+        {
+            Next = TaskId;
+        }
+    }
+
+    /* The task can be activated again as soon as it starts */
+    Primask = Os_CpuSaveAndDisable();
+    g_Event_Activations &= ~((uint32)1 << Next);
+    Os_CpuRestore(Primask);
+
+    Os_RunTask(Next, FALSE);
+}
+#endif
+
+#if (OS_TICK_OVERRUN_MODE == OS_OVERRUN_SKIP) && (OS_SCHEDULING_MODE == OS_SCHEDULING_COOPERATIVE)
+/*********************************************************************************************/
+static void Os_SkipTick(void)
+{
+    const Os_ScheduleTableType * Schedule = g_Schedule;
+    const Os_ExpiryPointType * ExpiryPoint = &Schedule->ExpiryPoints[g_Expiry_Point_Index];
+    uint16 TaskIndex;
+
+    /* Account the activations of this tick without executing them */
+    if(ExpiryPoint->Offset == g_Time_Tick_Count)
+    {
+        for(TaskIndex = ExpiryPoint->FirstTask; TaskIndex < (ExpiryPoint + 1)->FirstTask; TaskIndex++)
+        {
+            g_Task_Late_Activation_Count[Schedule->ExpiryTasks[TaskIndex]]++;
+        }
+
+        g_Expiry_Point_Index++;
+        if(g_Expiry_Point_Index == Schedule->ExpiryPointCount)
+        {
+            g_Expiry_Point_Index = 0;
+        }
+    }
+
+    Os_NextTick();
+}
+#endif
+
+#if (OS_TICKLESS_IDLE == STD_ON)
+/*********************************************************************************************/
+static void Os_Idle(void)
+{
+    const Os_ScheduleTableType * Schedule = g_Schedule;
+    uint32 Idle_Ticks;
+    uint32 Elapsed_Ticks;
+#if (OS_ALARMS == STD_ON)
+    uint32 Alarm_Ticks;
+#endif
+#if (OS_APERIODIC_SERVER == STD_ON)
+    uint32 Server_Ticks;
+#endif
+
+    /* Interrupts stay masked until the sleep decision is done, WFI still wakes up on a pending one */
+    Disable_Exceptions();
+
+    if((g_Tick_Counter == g_Processed_Ticks) && (g_Event_Activations == 0))
+    {
+        /* Number of ticks until the tick that processes the next expiry point. The sleep never goes past
+         * the last tick of the hyperperiod, a requested schedule starts after it. */
+        if(Schedule->ExpiryPoints[g_Expiry_Point_Index].Offset >= g_Time_Tick_Count)
+        {
+            Idle_Ticks = (uint32)(Schedule->ExpiryPoints[g_Expiry_Point_Index].Offset - g_Time_Tick_Count) + 1;
+        }
+        else
+        {
+            Idle_Ticks = (uint32)(Schedule->Hyperperiod - g_Time_Tick_Count);
+        }
+#if (OS_ALARMS == STD_ON)
+        /* Wake up for the next alarm expiry as well */
+        Alarm_Ticks = Os_AlarmGetIdleTicks();
+        if(Alarm_Ticks < Idle_Ticks)
+        {
+            Idle_Ticks = Alarm_Ticks;
+        }
+#endif
+#if (OS_APERIODIC_SERVER == STD_ON)
+        /* And for the budget of the aperiodic server if jobs wait for it */
+        Server_Ticks = Os_ServerGetIdleTicks(g_Tick_Counter);
+        if(Server_Ticks < Idle_Ticks)
+        {
+            Idle_Ticks = Server_Ticks;
+        }
+#endif
+        if(Idle_Ticks > SysTick_GetMaxSuppressedTicks())
+        {
+            Idle_Ticks = SysTick_GetMaxSuppressedTicks();
+        }
+
+        if((Idle_Ticks > 1) && (SysTick_SuppressTicks(Idle_Ticks) == E_OK))
+        {
+            Wait_For_Interrupt();
+
+            /* Correct the Os time from the SysTick counter, the woken up tick is not served by the ISR */
+            Elapsed_Ticks = SysTick_ResumeTicks();
+            if(Elapsed_Ticks > 0)
+            {
+                /* All the slept ticks have no expiry point, only the last one has to be processed,
+                 * the other ones are not late so they are marked as processed here */
+                g_Time_Tick_Count  = (uint16)((g_Time_Tick_Count + Elapsed_Ticks - 1) % Schedule->Hyperperiod);
+                g_Processed_Ticks += Elapsed_Ticks - 1;
+                g_Tick_Counter    += Elapsed_Ticks - 1;
+                if(g_Tick_Counter < (Elapsed_Ticks - 1))
+                {
+                    g_Tick_Counter_High++;
+                }
+
+                /* Count the last tick as if it came from the SysTick interrupt */
+                Os_NewTimerTick();
+            }
+        }
+        else
+        {
+            /* The next tick is due anyway, just sleep until it comes */
+            Wait_For_Interrupt();
+        }
+    }
+
+    Enable_Exceptions();
 }
+#endif
 /*********************************************************************************************/
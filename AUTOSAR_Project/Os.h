@@ -14,10 +14,223 @@
 
 #include "Std_Types.h"
 
-/* Timer counting time in ms */
-#define OS_BASE_TIME 20
+/* Os Module Id */
+#define OS_MODULE_ID                   (1U)
 
-/* Description: 
+/* Os Instance Id */
+#define OS_INSTANCE_ID                 (0U)
+
+/* Service ID for Os_NewTimerTick */
+#define OS_NEW_TIMER_TICK_SID          (uint8)0x01
+
+/* Service ID for the end of a task (reported by the Os itself) */
+#define OS_TERMINATE_TASK_SID          (uint8)0x02
+
+/* DET code to report that a stack overflowed its canary words */
+#define OS_E_STACK_FAULT               (uint8)0x01
+
+/* DET code to report a task ending while it still holds a resource */
+#define OS_E_RESOURCE                  (uint8)0x02
+
+/* Handling of the ticks the scheduler could not process on time (OS_TICK_OVERRUN_MODE) */
+#define OS_OVERRUN_CATCH_UP            (0U)   /* Process every late tick and run all its tasks */
+#define OS_OVERRUN_SKIP                (1U)   /* Only process the latest tick, count the dropped activations */
+
+/* Scheduling of the tasks (OS_SCHEDULING_MODE) */
+#define OS_SCHEDULING_COOPERATIVE      (0U)   /* Run to completion in the scheduler loop, in schedule order */
+#define OS_SCHEDULING_PREEMPTIVE       (1U)   /* Fixed priorities, own stack per task, PendSV context switch */
+#define OS_SCHEDULING_NVIC             (2U)   /* Fixed priorities, every task is a spare IRQ handler on the main stack */
+
+/* Errors reported to the protection hook (OS_TIMING_PROTECTION) */
+#define OS_PROTECTION_BUDGET           (0U)   /* The task ran longer than its execution budget */
+#define OS_PROTECTION_RUNAWAY          (1U)   /* Still running one more budget later: the task is most likely stuck */
+#define OS_PROTECTION_DEADLINE         (2U)   /* The task finished after its deadline */
+
+/* Reactions returned by the protection hook */
+#define OS_PRO_IGNORE                  (0U)   /* Only count the error, the task goes on */
+#define OS_PRO_SKIP_ACTIVATION         (1U)   /* The task goes on, its next scheduled activation is dropped */
+#define OS_PRO_RESET                   (2U)   /* Reset the ECU (system reset request) */
+
+/* Os Pre-Compile Configuration Header file (generated from Os_Cfg.json) */
+#include "Os_Cfg.h"
+
+/* Number of the log-scale buckets of the execution time histograms:
+ * bucket 0 counts the runs shorter than 256 cycles, bucket n the runs of 2^(n+7) to 2^(n+8)-1
+ * cycles and the last bucket all the longer runs */
+#define OS_EXECUTION_TIME_BUCKETS      (12U)
+
+/*
+ * Interrupts used by the Os, their levels are also in the Irq configuration table (Irq_PBcfg.c):
+ * - PendSV switches the tasks of the preemptive mode at the lowest level, after all the ISRs.
+ * - Task n of the NVIC mode is the handler of IRQ OS_TASK_IRQ_BASE + n: the contiguous SSI2,
+ *   SSI3 and UART3 - UART7 vectors, not used by the application. The generated
+ *   OS_TASK_IRQ_PRIORITY_n of Os_Cfg.h give their levels.
+ * - The budget timer of the timing protection (Wide Timer 5A) is above SysTick, the tasks and
+ *   the SchM exclusive areas, so a task stuck with the interrupts masked up to level 3 is still caught.
+ */
+#define OS_PENDSV_PRIORITY             (7U)
+#define OS_TASK_IRQ_BASE               (57U)
+#define OS_TASK_IRQ_COUNT              (7U)
+#define OS_BUDGET_IRQ                  (104U)
+#define OS_BUDGET_IRQ_PRIORITY         (2U)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for the task index used by the Os APIs */
+typedef uint8 Os_TaskType;
+
+/* Type definition for the entry function of a task */
+typedef void (*Os_TaskEntryType)(void);
+
+/* Description: Structure to describe one periodic task */
+typedef struct
+{
+    /* Function executed on every activation of the task */
+    Os_TaskEntryType Entry;
+    /* Activation period in ticks of OS_BASE_TIME, 0 for an event task only run by Os_ActivateTask */
+    uint16 Period;
+    /* Tick of the first activation inside the period */
+    uint16 Offset;
+    /* Unique priority, higher value is higher priority (rate-monotonic by default) */
+    uint8 Priority;
+#if (OS_SCHEDULING_MODE == OS_SCHEDULING_PREEMPTIVE)
+    /* Stack of the task and its size in bytes */
+    uint32 * Stack;
+    uint16 StackSize;
+#elif (OS_SCHEDULING_MODE == OS_SCHEDULING_NVIC)
+    /* NVIC priority of the task IRQ (0 - 7, 0 is the highest), it is the SRP preemption level */
+    uint8 IrqPriority;
+#endif
+#if (OS_TIMING_PROTECTION == STD_ON)
+    /* Execution budget of one run in microseconds, 0 for no budget */
+    uint32 BudgetUs;
+    /* Deadline in ticks after the activation, 0 for no deadline */
+    uint16 Deadline;
+#endif
+#if (OS_LET == STD_ON)
+    /* Called by the tick at the release of the task to latch its inputs, NULL_PTR if none */
+    Os_TaskEntryType LetInput;
+    /* Called by the tick at the end of the period to publish the outputs of the finished run, NULL_PTR if none */
+    Os_TaskEntryType LetOutput;
+#endif
+} Os_TaskConfigType;
+
+/* Description: Structure to describe one tick of the schedule that activates tasks */
+typedef struct
+{
+    /* Tick inside the hyperperiod */
+    uint16 Offset;
+    /* Index of the first task of this expiry point in the ExpiryTasks list */
+    uint16 FirstTask;
+} Os_ExpiryPointType;
+
+/* Type definition for the schedule index used by Os_SwitchSchedule */
+typedef uint8 Os_ScheduleType;
+
+/* Description: Structure to describe a precomputed schedule over one hyperperiod */
+typedef struct
+{
+    /* ExpiryPointCount entries followed by an end marker holding the total task count */
+    const Os_ExpiryPointType * ExpiryPoints;
+    /* Tasks activated by all the expiry points in dispatch order */
+    const Os_TaskType * ExpiryTasks;
+    /* Number of the expiry points in the schedule */
+    uint16 ExpiryPointCount;
+    /* Length of the schedule in ticks */
+    uint16 Hyperperiod;
+} Os_ScheduleTableType;
+
+/* Description: Structure to hold the measured execution times of one task in clock cycles */
+typedef struct
+{
+    /* Number of the measured runs */
+    uint32 Count;
+    /* Shortest and longest run (BCET and WCET observed so far) */
+    uint32 Min;
+    uint32 Max;
+    /* Average run */
+    uint32 Mean;
+    /* Number of runs in every log-scale bucket */
+    uint32 Histogram[OS_EXECUTION_TIME_BUCKETS];
+} Os_ExecutionTimeType;
+
+/* Description: Structure to hold the CPU load in permille (0 - 1000) */
+typedef struct
+{
+    /* Load of the last tick interval */
+    uint16 Current;
+    /* Load of the last complete window of OS_CPU_LOAD_WINDOW_TICKS ticks */
+    uint16 Windowed;
+    /* Highest load of a tick interval since the start or the last reset */
+    uint16 Peak;
+} Os_CpuLoadType;
+
+/* Type definition for the errors reported to the protection hook (OS_PROTECTION_xxx) */
+typedef uint8 Os_ProtectionErrorType;
+
+/* Type definition for the reaction returned by the protection hook (OS_PRO_xxx) */
+typedef uint8 Os_ProtectionReturnType;
+
+/* Description: Structure to hold the timing protection errors of one task */
+typedef struct
+{
+    /* Runs longer than the execution budget */
+    uint32 BudgetOverruns;
+    /* Runs that finished after the deadline */
+    uint32 DeadlineMisses;
+    /* Scheduled activations dropped on request of the protection hook */
+    uint32 SkippedActivations;
+} Os_ProtectionStatusType;
+
+/* Type definition for the resource index used by the Os APIs */
+typedef uint8 Os_ResourceType;
+
+/* Description: Structure to describe one resource shared by tasks */
+typedef struct
+{
+    /* Highest priority of the tasks using the resource (immediate priority ceiling) */
+    uint8 Ceiling;
+#if (OS_SCHEDULING_MODE == OS_SCHEDULING_NVIC)
+    /* Highest NVIC priority (lowest value) of the task IRQs using the resource */
+    uint8 IrqCeiling;
+#endif
+} Os_ResourceConfigType;
+
+/* Type definition for the Ioc queue index used by the Os APIs */
+typedef uint8 Os_QueueType;
+
+/* Description: Structure to describe one Ioc queue, its slots are allocated by the generator */
+typedef struct
+{
+    /* Length slots of ElementSize bytes */
+    uint8 * Buffer;
+    /* Multi-producer queue: one flag per slot set when the slot is committed, NULL_PTR otherwise */
+    volatile uint8 * Ready;
+    uint16 ElementSize;
+    /* Number of slots, a power of 2 */
+    uint16 Length;
+} Os_QueueConfigType;
+
+/* Data Structure required for starting the Os Scheduler */
+typedef struct
+{
+    Os_TaskConfigType Tasks[OS_TASK_COUNT];
+    Os_ScheduleTableType Schedules[OS_SCHEDULE_COUNT];
+#if (OS_RESOURCE_COUNT > 0U)
+    Os_ResourceConfigType Resources[OS_RESOURCE_COUNT];
+#endif
+#if (OS_IOC_QUEUE_COUNT > 0U)
+    Os_QueueConfigType Queues[OS_IOC_QUEUE_COUNT];
+#endif
+} Os_ConfigType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Description:
  * Function responsible for:
  * 1. Enable Interrupts
  * 2. Start the Os timer
@@ -32,4 +245,159 @@ void Os_Scheduler(void);
 /* Description: Function called by the Timer Driver in the MCAL layer using the call back pointer */
 void Os_NewTimerTick(void);
 
+/*
+ * Description: Activate a task once, mainly for the event tasks. It runs as soon as its priority
+ *              allows (cooperative mode: after the pending ticks, in priority order).
+ *              Returns E_NOT_OK for an invalid task or if the task is still activated.
+ */
+Std_ReturnType Os_ActivateTask(Os_TaskType TaskId);
+
+/*
+ * Description: Request another schedule, it replaces the running one at the end of its hyperperiod
+ *              so every task keeps a whole number of periods. A later request made before that
+ *              boundary replaces this one. Returns E_NOT_OK for an invalid schedule.
+ */
+Std_ReturnType Os_SwitchSchedule(Os_ScheduleType ScheduleId);
+
+/* Description: Get the schedule the scheduler is running */
+Os_ScheduleType Os_GetSchedule(void);
+
+/* Description: Get the number of Os ticks (OS_BASE_TIME) since the Os started, 64-bit so it never wraps */
+uint64 Os_GetTicks(void);
+
+/*
+ * Description: Get the time since the Os started in microseconds: the Os ticks plus the live
+ *              SysTick counter, 64-bit and monotonic. Callable from tasks, ISRs and with
+ *              interrupts disabled.
+ */
+uint64 Os_GetTimeUs(void);
+
+/* Description: Get the number of times a task was still running when the next tick expired */
+uint32 Os_GetTaskOverrunCount(Os_TaskType TaskId);
+
+/*
+ * Description: Get the number of activations of a task that were started late (catch-up mode)
+ *              or dropped (skip mode) because the scheduler missed ticks.
+ */
+uint32 Os_GetTaskLateActivationCount(Os_TaskType TaskId);
+
+/* Description: Get the number of ticks the scheduler could not process on time */
+uint32 Os_GetLostTickCount(void);
+
+#if (OS_RESOURCE_COUNT > 0U)
+/*
+ * Description: Occupy a resource (OSEK GetResource): the calling task runs at the ceiling priority
+ *              of the resource, so no other task using it can start until Os_ReleaseResource.
+ *              Returns E_NOT_OK for an invalid or occupied resource, when not called by a task or
+ *              by a task not declared as a user of the resource.
+ */
+Std_ReturnType Os_GetResource(Os_ResourceType ResId);
+
+/*
+ * Description: Release a resource (OSEK ReleaseResource), the resources are released in the reverse
+ *              order they were occupied. Returns E_NOT_OK for an invalid resource or one that is not
+ *              the last one occupied by the calling task.
+ */
+Std_ReturnType Os_ReleaseResource(Os_ResourceType ResId);
+#endif
+
+#if (OS_IOC_QUEUE_COUNT > 0U)
+/*
+ * Description: Ioc queues between tasks and ISRs, lock-free: no interrupt is disabled. A queue has
+ *              one consumer context and one producer context, or any number of producers for the
+ *              MultiProducer queues. Reserve a free slot to be written in place, NULL_PTR when the
+ *              queue is full (counted as lost), then Commit it to make it visible to the consumer.
+ */
+void * Os_IocReserve(Os_QueueType QueueId);
+void Os_IocCommit(Os_QueueType QueueId, void * Slot);
+
+/*
+ * Description: Get the oldest committed slot to be read in place, NULL_PTR when the queue is empty,
+ *              then Release it to give it back to the producers.
+ */
+const void * Os_IocPeek(Os_QueueType QueueId);
+void Os_IocRelease(Os_QueueType QueueId);
+
+/* Description: Copy one element into a queue. Returns E_NOT_OK for an invalid queue or a full queue */
+Std_ReturnType Os_IocSend(Os_QueueType QueueId, const void * Data);
+
+/* Description: Copy the oldest element out of a queue. Returns E_NOT_OK for an invalid queue or an empty queue */
+Std_ReturnType Os_IocReceive(Os_QueueType QueueId, void * Data);
+
+/* Description: Get the number of elements that could not be sent because the queue was full */
+uint32 Os_IocGetLostCount(Os_QueueType QueueId);
+#endif
+
+#if (OS_TIMING_PROTECTION == STD_ON)
+/*
+ * Description: Protection hook, implemented by the application and named in Os_Cfg.json. Called
+ *              from the budget timer ISR for OS_PROTECTION_BUDGET / OS_PROTECTION_RUNAWAY and from
+ *              the task context, after the task, for OS_PROTECTION_DEADLINE. Returns the reaction.
+ */
+Os_ProtectionReturnType OS_PROTECTION_HOOK(Os_TaskType TaskId, Os_ProtectionErrorType Error);
+
+/* Description: Get the timing protection errors of a task. Returns E_NOT_OK for an invalid task or a NULL_PTR */
+Std_ReturnType Os_GetTaskProtectionStatus(Os_TaskType TaskId, Os_ProtectionStatusType * Status);
+#endif
+
+#if (OS_LET == STD_ON)
+/*
+ * Description: Get the number of periods a task did not finish in: the outputs of the run were not
+ *              published at the end of the period (they are at the end of the period it finishes in).
+ */
+uint32 Os_GetLetViolationCount(Os_TaskType TaskId);
+#endif
+
+#if (OS_STACK_MONITORING == STD_ON)
+/*
+ * Description: Get the high-water mark of the main stack in bytes: the deepest use since reset
+ *              by the startup code, the scheduler, the ISRs and the tasks without an own stack.
+ */
+uint32 Os_GetStackUsage(void);
+
+/*
+ * Description: Get the high-water mark in bytes of the own stack of a task (preemptive mode).
+ *              Returns E_NOT_OK for an invalid task, a NULL_PTR or when the tasks run on the
+ *              main stack (cooperative and NVIC modes).
+ */
+Std_ReturnType Os_GetTaskStackUsage(Os_TaskType TaskId, uint32 * Usage);
+#endif
+
+#if (OS_CPU_LOAD_MEASUREMENT == STD_ON)
+/*
+ * Description: Get the CPU load measured from the idle time: the time the scheduler spends in its
+ *              idle path is idle, the tasks, the ISRs and the scheduler itself are load.
+ *              Returns E_NOT_OK for a NULL_PTR.
+ */
+Std_ReturnType Os_GetCpuLoad(Os_CpuLoadType * CpuLoad);
+
+/* Description: Restart the peak CPU load measurement */
+void Os_ResetPeakCpuLoad(void);
+#endif
+
+#if (OS_EXECUTION_TIME_MEASUREMENT == STD_ON)
+/*
+ * Description: Get the execution times measured for a task. The time spent in preempting tasks
+ *              is excluded, the time spent in the ISRs is included. Returns E_NOT_OK for an
+ *              invalid task or a NULL_PTR.
+ */
+Std_ReturnType Os_GetTaskExecutionTime(Os_TaskType TaskId, Os_ExecutionTimeType * ExecutionTime);
+
+/* Description: Clear the execution times measured for all the tasks */
+void Os_ResetExecutionTimes(void);
+
+/*
+ * Description: Print the execution times of all the tasks as text lines on the ITM stimulus
+ *              port 0 (SWO debug channel). Does nothing while the debugger has not enabled it.
+ */
+void Os_DumpExecutionTimes(void);
+#endif
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by Os */
+extern const Os_ConfigType Os_Configuration;
+
 #endif /* OS_H_ */
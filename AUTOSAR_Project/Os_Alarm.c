@@ -0,0 +1,309 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Alarm.c
+ *
+ * Description: Source file for the alarm service of the Os Scheduler. The
+ *              alarms are kept in a hierarchical timing wheel advanced by the
+ *              Os tick: start, cancel and expiry are O(1) per alarm, an alarm
+ *              only moves down one level at a time when its slot is reached.
+ *              The expired alarms are handed to the event task Os_AlarmTask,
+ *              so the callbacks run in task context and not in the SysTick ISR.
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#include "Os_Alarm.h"
+#include "Os_Kernel.h"
+
+#if (OS_ALARMS == STD_ON)
+
+/* Alarm states */
+#define OS_ALARM_STOPPED           (0U)
+#define OS_ALARM_RUNNING           (1U)
+#define OS_ALARM_EXPIRED           (2U)
+
+/*
+ * Timing wheel: 4 levels of 32 slots. A slot of level n covers 32^n ticks, so
+ * the wheel spans 2^20 ticks; longer delays wait in the farthest slot of the
+ * last level and go around again when it is reached.
+ */
+#define OS_ALARM_LEVELS            (4U)
+#define OS_ALARM_SLOT_BITS         (5U)
+#define OS_ALARM_SLOTS             (1U << OS_ALARM_SLOT_BITS)
+#define OS_ALARM_SLOT_MASK         (OS_ALARM_SLOTS - 1U)
+#define OS_ALARM_WHEEL_SPAN        ((uint32)1 << (OS_ALARM_LEVELS * OS_ALARM_SLOT_BITS))
+#define OS_ALARM_MAX_DELAY         (0x7FFFFFFFUL)
+
+/* Slots of the wheel, every slot is the head of a list of alarms */
+static Os_AlarmType * g_Alarm_Wheel[OS_ALARM_LEVELS][OS_ALARM_SLOTS];
+
+/* Alarms waiting for Os_AlarmTask to call them */
+static Os_AlarmType * g_Alarm_Expired = NULL_PTR;
+
+/* Tick counter value the wheel has been advanced to */
+static uint32 g_Alarm_Time = 0;
+
+static void Os_AlarmLink(Os_AlarmType ** Head, Os_AlarmType * Alarm);
+static void Os_AlarmUnlink(Os_AlarmType * Alarm);
+static void Os_AlarmInsert(Os_AlarmType * Alarm);
+static void Os_AlarmCascade(uint8 Level);
+
+/*********************************************************************************************/
+static void Os_AlarmLink(Os_AlarmType ** Head, Os_AlarmType * Alarm)
+{
+    /* Each alarm points to the link pointing to it, so it can be removed without searching */
+    Alarm->Next = *Head;
+    Alarm->Link = Head;
+    if(*Head != NULL_PTR)
+    {
+        (*Head)->Link = &Alarm->Next;
+    }
+    *Head = Alarm;
+}
+
+/*********************************************************************************************/
+static void Os_AlarmUnlink(Os_AlarmType * Alarm)
+{
+    *Alarm->Link = Alarm->Next;
+    if(Alarm->Next != NULL_PTR)
+    {
+        Alarm->Next->Link = Alarm->Link;
+    }
+    Alarm->Next = NULL_PTR;
+    Alarm->Link = NULL_PTR;
+}
+
+/*********************************************************************************************/
+static void Os_AlarmInsert(Os_AlarmType * Alarm)
+{
+    uint32 Delay = Alarm->Expiry - g_Alarm_Time;
+    uint32 Expiry = Alarm->Expiry;
+    uint8 Level = 0;
+
+    if(Delay >= OS_ALARM_WHEEL_SPAN)
+    {
+        /* Wait in the farthest slot, the alarm is inserted again from there */
+        Delay  = OS_ALARM_WHEEL_SPAN - 1U;
+        Expiry = g_Alarm_Time + Delay;
+    }
+
+    /* The lowest level whose slots still cover the delay */
+    while(Delay >= ((uint32)OS_ALARM_SLOTS << (Level * OS_ALARM_SLOT_BITS)))
+    {
+        Level++;
+    }
+
+    Os_AlarmLink(&g_Alarm_Wheel[Level][(Expiry >> (Level * OS_ALARM_SLOT_BITS)) & OS_ALARM_SLOT_MASK], Alarm);
+}
+
+/*********************************************************************************************/
+static void Os_AlarmCascade(uint8 Level)
+{
+    Os_AlarmType ** Slot = &g_Alarm_Wheel[Level][(g_Alarm_Time >> (Level * OS_ALARM_SLOT_BITS)) & OS_ALARM_SLOT_MASK];
+    Os_AlarmType * Alarm;
+
+    /* The slot is reached: its alarms are due within the span of the lower levels */
+    while(*Slot != NULL_PTR)
+    {
+        Alarm = *Slot;
+        Os_AlarmUnlink(Alarm);
+        Os_AlarmInsert(Alarm);
+    }
+}
+
+/*********************************************************************************************/
+void Os_AlarmTick(uint32 TickCounter)
+{
+    Os_AlarmType ** Slot;
+    Os_AlarmType * Alarm;
+    uint32 Primask;
+    uint8 Level;
+
+    /* One step per tick, a tickless period is caught up here. Each step is masked against
+     * an ISR above the SysTick starting or cancelling an alarm while the lists are relinked */
+    while(g_Alarm_Time != TickCounter)
+    {
+        Primask = Os_CpuSaveAndDisable();
+        g_Alarm_Time++;
+
+        /* When a level wraps around, the next slot of the level above is spread over the lower ones */
+        for(Level = 1; Level < OS_ALARM_LEVELS; Level++)
+        {
+            if((g_Alarm_Time & (((uint32)1 << (Level * OS_ALARM_SLOT_BITS)) - 1U)) != 0)
+            {
+                break;
+            }
+            Os_AlarmCascade(Level);
+        }
+
+        /* All the alarms of the current slot of level 0 expire on this tick */
+        Slot = &g_Alarm_Wheel[0][g_Alarm_Time & OS_ALARM_SLOT_MASK];
+        while(*Slot != NULL_PTR)
+        {
+            Alarm = *Slot;
+            Os_AlarmUnlink(Alarm);
+            Alarm->State = OS_ALARM_EXPIRED;
+            Os_AlarmLink(&g_Alarm_Expired, Alarm);
+        }
+        Os_CpuRestore(Primask);
+    }
+
+    if(g_Alarm_Expired != NULL_PTR)
+    {
+        /* Already activated if the callbacks of the previous expiries are still running */
+        (void)Os_KernelActivateEvent(OsConf_OS_ALARMTASK_ID);
+    }
+}
+
+/*********************************************************************************************/
+uint32 Os_AlarmGetIdleTicks(void)
+{
+    uint32 Idle_Ticks = 0xFFFFFFFF;
+    uint32 Ticks;
+    uint8 Level;
+    uint8 Slot;
+
+    if(g_Alarm_Expired != NULL_PTR)
+    {
+        /* Os_AlarmTask has work to do */
+        return 0;
+    }
+
+    /* First alarm expiring on level 0 */
+    for(Ticks = 1; Ticks < OS_ALARM_SLOTS; Ticks++)
+    {
+        if(g_Alarm_Wheel[0][(g_Alarm_Time + Ticks) & OS_ALARM_SLOT_MASK] != NULL_PTR)
+        {
+            Idle_Ticks = Ticks;
+            break;
+        }
+    }
+
+    /* An alarm of the upper levels can only come down when level 0 wraps around */
+    Ticks = OS_ALARM_SLOTS - (g_Alarm_Time & OS_ALARM_SLOT_MASK);
+    if(Ticks < Idle_Ticks)
+    {
+        for(Level = 1; Level < OS_ALARM_LEVELS; Level++)
+        {
+            for(Slot = 0; Slot < OS_ALARM_SLOTS; Slot++)
+            {
+                if(g_Alarm_Wheel[Level][Slot] != NULL_PTR)
+                {
+                    return Ticks;
+                }
+            }
+        }
+    }
+
+    return Idle_Ticks;
+}
+
+/*********************************************************************************************/
+void Os_AlarmInit(Os_AlarmType * Alarm, Os_AlarmCallbackType Callback)
+{
+    if(Alarm != NULL_PTR)
+    {
+        Alarm->Next     = NULL_PTR;
+        Alarm->Link     = NULL_PTR;
+        Alarm->Callback = Callback;
+        Alarm->Expiry   = 0;
+        Alarm->Cycle    = 0;
+        Alarm->State    = OS_ALARM_STOPPED;
+    }
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_AlarmStart(Os_AlarmType * Alarm, uint32 Delay, uint32 Cycle)
+{
+    uint32 Primask;
+
+    if((Alarm == NULL_PTR) || (Delay == 0) || (Delay > OS_ALARM_MAX_DELAY) || (Cycle > OS_ALARM_MAX_DELAY))
+    {
+        return E_NOT_OK;
+    }
+
+    Primask = Os_CpuSaveAndDisable();
+    if(Alarm->State != OS_ALARM_STOPPED)
+    {
+        Os_AlarmUnlink(Alarm);
+    }
+    Alarm->Expiry = g_Alarm_Time + Delay;
+    Alarm->Cycle  = Cycle;
+    Alarm->State  = OS_ALARM_RUNNING;
+    Os_AlarmInsert(Alarm);
+    Os_CpuRestore(Primask);
+    return E_OK;
+}
+
+/*********************************************************************************************/
+void Os_AlarmCancel(Os_AlarmType * Alarm)
+{
+    uint32 Primask;
+
+    if(Alarm == NULL_PTR)
+    {
+        return;
+    }
+
+    Primask = Os_CpuSaveAndDisable();
+    if(Alarm->State != OS_ALARM_STOPPED)
+    {
+        Os_AlarmUnlink(Alarm);
+        Alarm->State = OS_ALARM_STOPPED;
+    }
+    Os_CpuRestore(Primask);
+}
+
+/*********************************************************************************************/
+boolean Os_AlarmIsActive(const Os_AlarmType * Alarm)
+{
+    return (boolean)((Alarm != NULL_PTR) && (Alarm->State != OS_ALARM_STOPPED));
+}
+
+/*********************************************************************************************/
+void Os_AlarmTask(void)
+{
+    Os_AlarmType * Alarm;
+    Os_AlarmCallbackType Callback;
+    uint32 Primask;
+
+    while(1)
+    {
+        Primask = Os_CpuSaveAndDisable();
+        Alarm = g_Alarm_Expired;
+        if(Alarm == NULL_PTR)
+        {
+            Os_CpuRestore(Primask);
+            break;
+        }
+
+        Os_AlarmUnlink(Alarm);
+        if(Alarm->Cycle != 0)
+        {
+            /* Keep the period on the original grid, the cycles missed while the callbacks
+             * were late are dropped */
+            do
+            {
+                Alarm->Expiry += Alarm->Cycle;
+            } while((sint32)(Alarm->Expiry - g_Alarm_Time) <= 0);
+            Alarm->State = OS_ALARM_RUNNING;
+            Os_AlarmInsert(Alarm);
+        }
+        else
+        {
+            Alarm->State = OS_ALARM_STOPPED;
+        }
+        Callback = Alarm->Callback;
+        Os_CpuRestore(Primask);
+
+        /* The callback may start or cancel any alarm, including this one */
+        if(Callback != NULL_PTR)
+        {
+            Callback();
+        }
+    }
+}
+
+#endif /* (OS_ALARMS == STD_ON) */
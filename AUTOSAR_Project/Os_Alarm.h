@@ -0,0 +1,73 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Alarm.h
+ *
+ * Description: Header file for the alarm service of the Os Scheduler: one-shot
+ *              and periodic software timers counted in Os ticks (OS_BASE_TIME).
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#ifndef OS_ALARM_H_
+#define OS_ALARM_H_
+
+#include "Os.h"
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for the function called when an alarm expires, it runs in Os_AlarmTask */
+typedef void (*Os_AlarmCallbackType)(void);
+
+/*
+ * Description: Structure to hold one alarm. The alarms are owned by the modules using them
+ *              (usually static variables) and the Os links them into its timing wheel,
+ *              the members are private to Os_Alarm.c.
+ */
+typedef struct Os_AlarmStruct
+{
+    /* Links of the wheel slot or of the expired list the alarm is in */
+    struct Os_AlarmStruct * Next;
+    struct Os_AlarmStruct ** Link;
+    /* Function called on every expiry */
+    Os_AlarmCallbackType Callback;
+    /* Tick of the next expiry */
+    uint32 Expiry;
+    /* Period in ticks of a periodic alarm, 0 for a one-shot alarm */
+    uint32 Cycle;
+    /* Stopped, running (in the wheel) or expired (waiting for Os_AlarmTask) */
+    uint8 State;
+} Os_AlarmType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+#if (OS_ALARMS == STD_ON)
+
+/* Description: Initialize a stopped alarm with the function to call when it expires */
+void Os_AlarmInit(Os_AlarmType * Alarm, Os_AlarmCallbackType Callback);
+
+/*
+ * Description: Start an alarm to expire in Delay ticks (at least 1) and then every Cycle ticks,
+ *              a Cycle of 0 makes a one-shot alarm. A running alarm is restarted.
+ *              Returns E_NOT_OK for a NULL_PTR alarm or a Delay out of 1 .. 0x7FFFFFFF.
+ *              O(1), callable from tasks and ISRs of any priority.
+ */
+Std_ReturnType Os_AlarmStart(Os_AlarmType * Alarm, uint32 Delay, uint32 Cycle);
+
+/* Description: Stop an alarm, its pending expiry is dropped. O(1), callable from tasks and ISRs of any priority */
+void Os_AlarmCancel(Os_AlarmType * Alarm);
+
+/* Description: Check if an alarm is running or expired and waiting for its callback */
+boolean Os_AlarmIsActive(const Os_AlarmType * Alarm);
+
+/* Description: Event task generated with OS_ALARMS, runs the callbacks of the expired alarms */
+void Os_AlarmTask(void);
+
+#endif
+
+#endif /* OS_ALARM_H_ */
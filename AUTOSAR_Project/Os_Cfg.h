@@ -0,0 +1,102 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for Os Scheduler.
+ *              Generated by Tools/Os_Gen.py from Os_Cfg.json - do not edit.
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#ifndef OS_CFG_H_
+#define OS_CFG_H_
+
+/* Pre-compile option for the tickless idle mode: sleep until the next expiry point */
+#define OS_TICKLESS_IDLE                     (STD_ON)
+
+/* Pre-compile option for the measurement of the task execution times (DWT cycle counter) */
+#define OS_EXECUTION_TIME_MEASUREMENT        (STD_ON)
+
+/* Pre-compile option for the measurement of the CPU load from the idle time */
+#ifndef OS_CPU_LOAD_MEASUREMENT
+#define OS_CPU_LOAD_MEASUREMENT              (STD_ON)
+#endif
+
+/* Pre-compile option for the stack high-water marks and the stack canary check on every tick */
+#define OS_STACK_MONITORING                  (STD_ON)
+
+/* Pre-compile option for the alarm service (timing wheel, callbacks run by Os_AlarmTask) */
+#define OS_ALARMS                            (STD_OFF)
+
+/* Pre-compile option for the trace recorder (task, ISR and marker records in a RAM ring buffer) */
+#define OS_TRACE                             (STD_ON)
+
+/* Pre-compile option for the task execution budgets (WTIMER5A) and deadlines with a protection hook */
+#define OS_TIMING_PROTECTION                 (STD_ON)
+
+/* Pre-compile option for the logical execution time: task inputs latched and outputs published by the tick */
+#define OS_LET                               (STD_ON)
+
+/* Pre-compile option for the aperiodic server: event-triggered jobs run by Os_ServerTask within a budget */
+#define OS_APERIODIC_SERVER                  (STD_ON)
+
+/* Pre-compile option for the ticks missed while a task runs too long: catch up or skip them */
+#define OS_TICK_OVERRUN_MODE                 (OS_OVERRUN_CATCH_UP)
+
+/* Pre-compile option for the task scheduling: cooperative executive, preemptive kernel or NVIC tasks */
+#define OS_SCHEDULING_MODE                   (OS_SCHEDULING_COOPERATIVE)
+
+/* Execution time the aperiodic server may use per replenishment period, in us */
+#define OS_SERVER_BUDGET_US                  (1000U)
+
+/* Replenishment period of the aperiodic server in ticks */
+#define OS_SERVER_PERIOD                     (1U)
+
+/* Number of jobs the queue of the aperiodic server holds */
+#define OS_SERVER_JOB_COUNT                  (8U)
+
+/* Function called on a budget overrun or a missed deadline, declared in Os.h */
+#define OS_PROTECTION_HOOK                   App_ProtectionHook
+
+/* Timer counting time in ms */
+#define OS_BASE_TIME                         (20U)
+
+/* Number of the configured Os Tasks */
+#define OS_TASK_COUNT                        (3U)
+
+/* Task Index in the array of structures in Os_PBcfg.c */
+#define OsConf_BUTTON_TASK_ID                (Os_TaskType)0
+#define OsConf_LED_TASK_ID                   (Os_TaskType)1
+#define OsConf_OS_SERVERTASK_ID              (Os_TaskType)2
+
+/* Number of the configured Os Resources */
+#define OS_RESOURCE_COUNT                    (1U)
+
+/* Resource Index in the array of structures in Os_PBcfg.c */
+#define OsConf_BUTTON_STATE_RESOURCE_ID      (Os_ResourceType)0
+
+/* Number of the configured Ioc queues */
+#define OS_IOC_QUEUE_COUNT                   (1U)
+
+/* Queue Index in the array of structures in Os_PBcfg.c */
+#define OsConf_BUTTON_EVENTS_QUEUE_ID        (Os_QueueType)0
+
+/* Number of the configured schedules, the first one is started by the Os */
+#define OS_SCHEDULE_COUNT                    (3U)
+
+/* Schedule Index in the array of structures in Os_PBcfg.c */
+#define OsConf_NORMAL_SCHEDULE_ID            (Os_ScheduleType)0
+#define OsConf_DEGRADED_SCHEDULE_ID          (Os_ScheduleType)1
+#define OsConf_LOWPOWER_SCHEDULE_ID          (Os_ScheduleType)2
+
+/* Number of ticks averaged by the windowed CPU load */
+#ifndef OS_CPU_LOAD_WINDOW_TICKS
+#define OS_CPU_LOAD_WINDOW_TICKS             (2U)
+#endif
+
+/* Number of records of the trace ring buffer, a power of 2 */
+#define OS_TRACE_RECORD_COUNT                (256U)
+
+#endif /* OS_CFG_H_ */
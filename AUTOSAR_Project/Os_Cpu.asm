@@ -0,0 +1,169 @@
+;******************************************************************************
+;
+; Module: Os
+;
+; File Name: Os_Cpu.asm
+;
+; Description: Cortex-M4F specific part of the Os Scheduler: start of the
+;              process stack and the PendSV context switch used by the
+;              preemptive mode, active IRQ used by the NVIC mode and the
+;              resources (Os_Kernel.c).
+;
+; Author: Mohannad Sabry
+;******************************************************************************
+
+        .thumb
+        .text
+
+        .global Os_CurrentTcb
+        .global Os_NextTcb
+
+        .global PendSV_Handler
+        .global Os_CpuStart
+        .global Os_CpuHighestBit
+        .global Os_CpuActiveIrq
+        .global Os_CpuSaveAndDisable
+        .global Os_CpuRestore
+        .global Os_CpuRaiseBasepri
+        .global Os_CpuSetBasepri
+        .global Os_CpuCompareAndSwap
+
+Os_CurrentTcbAddr:  .word   Os_CurrentTcb
+Os_NextTcbAddr:     .word   Os_NextTcb
+
+;******************************************************************************
+; PendSV_Handler
+; Save the context of Os_CurrentTcb on its process stack, restore the context
+; of Os_NextTcb and make it the current one. R0-R3, R12, LR, PC and xPSR are
+; stacked by the hardware, R4-R11 and EXC_RETURN are stacked here. S16-S31 are
+; only stacked when the task used the FPU (bit 4 of EXC_RETURN cleared).
+;******************************************************************************
+        .align  4
+PendSV_Handler: .asmfunc
+        CPSID   I
+        LDR     R3, Os_CurrentTcbAddr
+        LDR     R2, [R3]                ; R2 = Os_CurrentTcb
+        LDR     R1, Os_NextTcbAddr
+        LDR     R1, [R1]                ; R1 = Os_NextTcb
+        CMP     R1, R2
+        BEQ     PendSV_Exit
+
+        MRS     R0, PSP
+        TST     LR, #0x10
+        IT      EQ
+        VSTMDBEQ R0!, {S16-S31}
+        STMDB   R0!, {R4-R11, LR}
+        STR     R0, [R2]                ; Os_CurrentTcb->StackPointer = R0
+
+        STR     R1, [R3]                ; Os_CurrentTcb = Os_NextTcb
+        LDR     R0, [R1]                ; R0 = Os_NextTcb->StackPointer
+        LDMIA   R0!, {R4-R11, LR}
+        TST     LR, #0x10
+        IT      EQ
+        VLDMIAEQ R0!, {S16-S31}
+        MSR     PSP, R0
+
+PendSV_Exit:
+        CPSIE   I
+        BX      LR
+        .endasmfunc
+
+;******************************************************************************
+; void Os_CpuStart(uint32 * StackTop, void (*Entry)(void))
+; Thread mode switches from the main stack to the given process stack, the
+; main stack is only used by the exception handlers from now on.
+;******************************************************************************
+        .align  4
+Os_CpuStart: .asmfunc
+        MSR     PSP, R0
+        MOVS    R0, #2                  ; CONTROL.SPSEL = 1
+        MSR     CONTROL, R0
+        ISB
+        CPSIE   I
+        BLX     R1
+Os_CpuStart_Loop:
+        B       Os_CpuStart_Loop
+        .endasmfunc
+
+;******************************************************************************
+; uint32 Os_CpuHighestBit(uint32 Value)
+; Used by the ready list of the preemptive mode and the execution time histograms.
+;******************************************************************************
+        .align  4
+Os_CpuHighestBit: .asmfunc
+        CLZ     R0, R0
+        RSB     R0, R0, #31
+        BX      LR
+        .endasmfunc
+
+;******************************************************************************
+; uint32 Os_CpuActiveIrq(void)
+;******************************************************************************
+        .align  4
+Os_CpuActiveIrq: .asmfunc
+        MRS     R0, IPSR
+        SUB     R0, R0, #16             ; exception number to IRQ number
+        BX      LR
+        .endasmfunc
+
+;******************************************************************************
+; uint32 Os_CpuSaveAndDisable(void)
+; void Os_CpuRestore(uint32 Primask)
+; Nestable critical section: the previous PRIMASK is returned and restored.
+;******************************************************************************
+        .align  4
+Os_CpuSaveAndDisable: .asmfunc
+        MRS     R0, PRIMASK
+        CPSID   I
+        BX      LR
+        .endasmfunc
+
+        .align  4
+Os_CpuRestore: .asmfunc
+        MSR     PRIMASK, R0
+        BX      LR
+        .endasmfunc
+
+;******************************************************************************
+; uint32 Os_CpuRaiseBasepri(uint32 Basepri)
+; void Os_CpuSetBasepri(uint32 Basepri)
+; Mask the interrupts from a priority level down, the higher ones still run.
+; BASEPRI_MAX only ever raises the masking level, so a nested call with a
+; lower level keeps the current one. The previous BASEPRI is returned.
+;******************************************************************************
+        .align  4
+Os_CpuRaiseBasepri: .asmfunc
+        MRS     R1, BASEPRI
+        MSR     BASEPRI_MAX, R0
+        MOV     R0, R1
+        BX      LR
+        .endasmfunc
+
+        .align  4
+Os_CpuSetBasepri: .asmfunc
+        MSR     BASEPRI, R0
+        BX      LR
+        .endasmfunc
+
+;******************************************************************************
+; boolean Os_CpuCompareAndSwap(volatile uint32 * Address, uint32 Expected,
+;                              uint32 Desired)
+; Used by the multi-producer Ioc queues. An exception taken between LDREX and
+; STREX clears the exclusive monitor, the STREX then fails and the caller
+; reads the new value and tries again.
+;******************************************************************************
+        .align  4
+Os_CpuCompareAndSwap: .asmfunc
+        LDREX   R3, [R0]
+        CMP     R3, R1
+        BNE     Os_CpuCompareAndSwapFail
+        STREX   R3, R2, [R0]            ; R3 = 0 when stored
+        EOR     R0, R3, #1
+        BX      LR
+Os_CpuCompareAndSwapFail:
+        CLREX
+        MOVS    R0, #0
+        BX      LR
+        .endasmfunc
+
+        .end
@@ -0,0 +1,158 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_CpuLoad.c
+ *
+ * Description: Source file for the CPU load measurement of the Os Scheduler.
+ *              The idle path reports when it starts and stops idling and every
+ *              tick turns the idle cycles of the elapsed interval into a load.
+ *              The timestamps come from Os_TimingGetTimestamp, the calculation
+ *              itself has no hardware access and is also built on a host
+ *              against a simulated SysTick (Tests/Os_CpuLoad_Test.c).
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#include "Os_Kernel.h"
+
+#if (OS_CPU_LOAD_MEASUREMENT == STD_ON)
+
+/* Loads are given in permille */
+#define OS_CPU_LOAD_FULL           (1000U)
+
+/* Timestamp of the start of the current idle period, valid while g_Idle is TRUE */
+static uint32 g_Idle_Start = 0;
+static boolean g_Idle = FALSE;
+
+/* Idle cycles counted since the last tick */
+static uint32 g_Idle_Cycles = 0;
+
+/* Timestamp and tick counter of the last tick, the first tick only starts the measurement */
+static uint32 g_Last_Tick_Timestamp = 0;
+static uint32 g_Last_Tick_Counter = 0;
+static boolean g_Started = FALSE;
+
+/* Busy and total cycles of the current window */
+static uint32 g_Window_Busy_Cycles = 0;
+static uint32 g_Window_Total_Cycles = 0;
+static uint32 g_Window_Ticks = 0;
+
+/* Published loads */
+static Os_CpuLoadType g_Cpu_Load = { 0, 0, 0 };
+
+static uint16 Os_CpuLoadPermille(uint32 Busy, uint32 Total);
+
+/*********************************************************************************************/
+void Os_KernelIdleStart(void)
+{
+    uint32 Primask = Os_CpuSaveAndDisable();
+
+    Os_CpuLoadIdleStart(Os_TimingGetTimestamp());
+    Os_CpuRestore(Primask);
+}
+
+/*********************************************************************************************/
+void Os_KernelIdleEnd(void)
+{
+    uint32 Primask = Os_CpuSaveAndDisable();
+
+    Os_CpuLoadIdleEnd(Os_TimingGetTimestamp());
+    Os_CpuRestore(Primask);
+}
+
+/*********************************************************************************************/
+void Os_CpuLoadIdleStart(uint32 Timestamp)
+{
+    if(!g_Idle)
+    {
+        g_Idle_Start = Timestamp;
+        g_Idle       = TRUE;
+    }
+}
+
+/*********************************************************************************************/
+void Os_CpuLoadIdleEnd(uint32 Timestamp)
+{
+    if(g_Idle)
+    {
+        g_Idle_Cycles += Timestamp - g_Idle_Start;
+        g_Idle         = FALSE;
+    }
+}
+
+/*********************************************************************************************/
+void Os_CpuLoadTick(uint32 Timestamp, uint32 TickCounter)
+{
+    uint32 Total;
+    uint32 Busy;
+
+    /* An idle period running over the tick is split between the two intervals */
+    if(g_Idle)
+    {
+        g_Idle_Cycles += Timestamp - g_Idle_Start;
+        g_Idle_Start   = Timestamp;
+    }
+
+    if(g_Started)
+    {
+        /* After a tickless period the interval covers several ticks */
+        Total = Timestamp - g_Last_Tick_Timestamp;
+        Busy  = (g_Idle_Cycles < Total) ? (Total - g_Idle_Cycles) : 0;
+
+        g_Cpu_Load.Current = Os_CpuLoadPermille(Busy, Total);
+        if(g_Cpu_Load.Current > g_Cpu_Load.Peak)
+        {
+            g_Cpu_Load.Peak = g_Cpu_Load.Current;
+        }
+
+        g_Window_Busy_Cycles  += Busy;
+        g_Window_Total_Cycles += Total;
+        g_Window_Ticks        += TickCounter - g_Last_Tick_Counter;
+        if(g_Window_Ticks >= OS_CPU_LOAD_WINDOW_TICKS)
+        {
+            g_Cpu_Load.Windowed   = Os_CpuLoadPermille(g_Window_Busy_Cycles, g_Window_Total_Cycles);
+            g_Window_Busy_Cycles  = 0;
+            g_Window_Total_Cycles = 0;
+            g_Window_Ticks        = 0;
+        }
+    }
+
+    g_Started             = TRUE;
+    g_Idle_Cycles         = 0;
+    g_Last_Tick_Timestamp = Timestamp;
+    g_Last_Tick_Counter   = TickCounter;
+}
+
+/*********************************************************************************************/
+static uint16 Os_CpuLoadPermille(uint32 Busy, uint32 Total)
+{
+    if(Total == 0)
+    {
+        return 0;
+    }
+    /* 64-bit product: a window can hold more than 2^32 / 1000 cycles */
+    return (uint16)(((uint64)Busy * OS_CPU_LOAD_FULL) / Total);
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_GetCpuLoad(Os_CpuLoadType * CpuLoad)
+{
+    if(CpuLoad == NULL_PTR)
+    {
+        return E_NOT_OK;
+    }
+    /* Each load is a single 16-bit access, written by the tick only */
+    CpuLoad->Current  = g_Cpu_Load.Current;
+    CpuLoad->Windowed = g_Cpu_Load.Windowed;
+    CpuLoad->Peak     = g_Cpu_Load.Peak;
+    return E_OK;
+}
+
+/*********************************************************************************************/
+void Os_ResetPeakCpuLoad(void)
+{
+    g_Cpu_Load.Peak = 0;
+}
+
+#endif /* (OS_CPU_LOAD_MEASUREMENT == STD_ON) */
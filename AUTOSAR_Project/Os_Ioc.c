@@ -0,0 +1,230 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Ioc.c
+ *
+ * Description: Source file for the Ioc queues of the Os Scheduler: statically
+ *              allocated ring buffers of fixed size elements between tasks and
+ *              ISRs. The indexes are free-running counters, each one written
+ *              by one side only, so a single-producer queue needs no lock at
+ *              all. The producers of a multi-producer queue claim their slot
+ *              with LDREX/STREX and flag it when it is written. A DMB keeps
+ *              the element accesses on their side of the index and flag
+ *              updates.
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#include "Os_Kernel.h"
+
+#if (OS_IOC_QUEUE_COUNT > 0U)
+
+/* Description: Structure to hold the indexes of one queue */
+typedef struct
+{
+    /* Slots reserved by the producers (committed ones for a single-producer queue) */
+    volatile uint32 Head;
+    /* Slots released by the consumer */
+    volatile uint32 Tail;
+    /* Elements dropped because the queue was full */
+    volatile uint32 Lost;
+} Os_IocStateType;
+
+static Os_IocStateType g_Ioc_State[OS_IOC_QUEUE_COUNT];
+
+static void Os_IocCountLost(Os_IocStateType * State);
+
+/*********************************************************************************************/
+static void Os_IocCountLost(Os_IocStateType * State)
+{
+    uint32 Lost;
+
+    /* Several producers can fail at the same time */
+    do
+    {
+        Lost = State->Lost;
+    } while(!Os_CpuCompareAndSwap(&State->Lost, Lost, Lost + 1U));
+}
+
+/*********************************************************************************************/
+void * Os_IocReserve(Os_QueueType QueueId)
+{
+    const Os_QueueConfigType * Queue;
+    Os_IocStateType * State;
+    uint32 Head;
+
+    if(QueueId >= OS_IOC_QUEUE_COUNT)
+    {
+        return NULL_PTR;
+    }
+    Queue = &Os_Configuration.Queues[QueueId];
+    State = &g_Ioc_State[QueueId];
+
+    if(Queue->Ready == NULL_PTR)
+    {
+        /* The only producer: the slot is claimed by the commit */
+        Head = State->Head;
+        if((Head - State->Tail) >= Queue->Length)
+        {
+            Os_IocCountLost(State);
+            return NULL_PTR;
+        }
+    }
+    else
+    {
+        /* Claim the slot at Head, a producer preempting in between makes the swap fail */
+        do
+        {
+            Head = State->Head;
+            if((Head - State->Tail) >= Queue->Length)
+            {
+                Os_IocCountLost(State);
+                return NULL_PTR;
+            }
+        } while(!Os_CpuCompareAndSwap(&State->Head, Head, Head + 1U));
+    }
+
+    return &Queue->Buffer[(Head & (Queue->Length - 1U)) * Queue->ElementSize];
+}
+
+/*********************************************************************************************/
+void Os_IocCommit(Os_QueueType QueueId, void * Slot)
+{
+    const Os_QueueConfigType * Queue;
+
+    if((QueueId >= OS_IOC_QUEUE_COUNT) || (Slot == NULL_PTR))
+    {
+        return;
+    }
+    Queue = &Os_Configuration.Queues[QueueId];
+
+    if(Queue->Ready == NULL_PTR)
+    {
+        /* The element is written before the index that publishes it */
+        Data_Memory_Barrier();
+        g_Ioc_State[QueueId].Head++;
+    }
+    else
+    {
+        /* The slots are read in order: a slot committed before an older one waits for it */
+        Data_Memory_Barrier();
+        Queue->Ready[((uint8 *)Slot - Queue->Buffer) / Queue->ElementSize] = 1U;
+    }
+}
+
+/*********************************************************************************************/
+const void * Os_IocPeek(Os_QueueType QueueId)
+{
+    const Os_QueueConfigType * Queue;
+    Os_IocStateType * State;
+    uint32 Index;
+
+    if(QueueId >= OS_IOC_QUEUE_COUNT)
+    {
+        return NULL_PTR;
+    }
+    Queue = &Os_Configuration.Queues[QueueId];
+    State = &g_Ioc_State[QueueId];
+
+    if(State->Tail == State->Head)
+    {
+        return NULL_PTR;
+    }
+    Index = State->Tail & (Queue->Length - 1U);
+    if((Queue->Ready != NULL_PTR) && (Queue->Ready[Index] == 0U))
+    {
+        /* Reserved but not written yet */
+        return NULL_PTR;
+    }
+    /* The element is read after the index or the flag that published it */
+    Data_Memory_Barrier();
+    return &Queue->Buffer[Index * Queue->ElementSize];
+}
+
+/*********************************************************************************************/
+void Os_IocRelease(Os_QueueType QueueId)
+{
+    const Os_QueueConfigType * Queue;
+    Os_IocStateType * State;
+
+    if(QueueId >= OS_IOC_QUEUE_COUNT)
+    {
+        return;
+    }
+    Queue = &Os_Configuration.Queues[QueueId];
+    State = &g_Ioc_State[QueueId];
+
+    if(State->Tail != State->Head)
+    {
+        /* The element is read before the slot is given back to the producers */
+        Data_Memory_Barrier();
+        if(Queue->Ready != NULL_PTR)
+        {
+            /* Cleared before the slot is given back to the producers */
+            Queue->Ready[State->Tail & (Queue->Length - 1U)] = 0U;
+            Data_Memory_Barrier();
+        }
+        State->Tail++;
+    }
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_IocSend(Os_QueueType QueueId, const void * Data)
+{
+    uint8 * Slot;
+    uint16 Byte;
+
+    if(Data == NULL_PTR)
+    {
+        return E_NOT_OK;
+    }
+    Slot = (uint8 *)Os_IocReserve(QueueId);
+    if(Slot == NULL_PTR)
+    {
+        return E_NOT_OK;
+    }
+    for(Byte = 0; Byte < Os_Configuration.Queues[QueueId].ElementSize; Byte++)
+    {
+        Slot[Byte] = ((const uint8 *)Data)[Byte];
+    }
+    Os_IocCommit(QueueId, Slot);
+    return E_OK;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_IocReceive(Os_QueueType QueueId, void * Data)
+{
+    const uint8 * Slot;
+    uint16 Byte;
+
+    if(Data == NULL_PTR)
+    {
+        return E_NOT_OK;
+    }
+    Slot = (const uint8 *)Os_IocPeek(QueueId);
+    if(Slot == NULL_PTR)
+    {
+        return E_NOT_OK;
+    }
+    for(Byte = 0; Byte < Os_Configuration.Queues[QueueId].ElementSize; Byte++)
+    {
+        ((uint8 *)Data)[Byte] = Slot[Byte];
+    }
+    Os_IocRelease(QueueId);
+    return E_OK;
+}
+
+/*********************************************************************************************/
+uint32 Os_IocGetLostCount(Os_QueueType QueueId)
+{
+    uint32 Count = 0;
+
+    if(QueueId < OS_IOC_QUEUE_COUNT)
+    {
+        Count = g_Ioc_State[QueueId].Lost;
+    }
+    return Count;
+}
+
+#endif /* (OS_IOC_QUEUE_COUNT > 0U) */
@@ -0,0 +1,399 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Kernel.c
+ *
+ * Description: Source file for the fixed-priority preemptive kernels of the Os
+ *              Scheduler. In the preemptive mode every task runs to completion
+ *              on its own stack and the context switches are done by
+ *              PendSV_Handler in Os_Cpu.asm. In the NVIC mode every task is the
+ *              handler of a spare IRQ and the NVIC does the preemption, all the
+ *              tasks share the main stack.
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#include "Os_Kernel.h"
+#include "Os_Trace.h"
+#include "Irq.h"
+
+/*
+ * Context of the running task and of the task PendSV_Handler has to switch to.
+ * Defined in all the scheduling modes as they are referenced by Os_Cpu.asm.
+ */
+Os_TaskControlBlockType * volatile Os_CurrentTcb = NULL_PTR;
+Os_TaskControlBlockType * volatile Os_NextTcb    = NULL_PTR;
+
+#if (OS_SCHEDULING_MODE == OS_SCHEDULING_PREEMPTIVE)
+
+/* Task states */
+#define OS_TASK_SUSPENDED          (0U)   /* Not activated */
+#define OS_TASK_READY              (1U)   /* Activated but its context is not created yet */
+#define OS_TASK_STARTED            (2U)   /* Running or preempted, its context is on its stack */
+
+/* Initial exception frame of a task: Thumb state, return to Thread mode using the process stack */
+#define OS_INITIAL_XPSR            0x01000000
+#define OS_INITIAL_EXC_RETURN      0xFFFFFFFD
+
+/* Context of every task and of the idle loop */
+static Os_TaskControlBlockType Os_TaskTcb[OS_TASK_COUNT];
+static Os_TaskControlBlockType Os_IdleTcb;
+
+/* Stack of the idle loop, the stacks of the tasks are generated in Os_PBcfg.c */
+#pragma DATA_ALIGN(Os_IdleStack, 8)
+uint32 Os_IdleStack[OS_IDLE_STACK_SIZE / 4];
+
+/* One bit per priority level of the tasks that are ready or started */
+static volatile uint32 Os_ReadyPriorities = 0;
+
+/* Task owning every priority level (the priorities are unique) */
+static Os_TaskType Os_PriorityTask[OS_TASK_COUNT];
+
+/*
+ * System ceiling: one bit per priority level blocked by the resources held, and the task running
+ * at the ceiling. Only the ready tasks above the ceiling can preempt it.
+ */
+static uint32 Os_CeilingPriorities = 0;
+static Os_TaskType Os_CeilingTask = 0;
+
+#if (OS_RESOURCE_COUNT > 0U)
+/* System ceiling before every resource held was occupied */
+static uint32 Os_ResourceSavedPriorities[OS_RESOURCE_COUNT];
+static Os_TaskType Os_ResourceSavedTask[OS_RESOURCE_COUNT];
+#endif
+
+static void Os_TaskWrapper(Os_TaskType TaskId);
+
+/*********************************************************************************************/
+void Os_KernelStart(void (*IdleLoop)(void))
+{
+    Os_TaskType TaskId;
+
+    for(TaskId = 0; TaskId < OS_TASK_COUNT; TaskId++)
+    {
+        Os_PriorityTask[Os_Configuration.Tasks[TaskId].Priority] = TaskId;
+#if (OS_STACK_MONITORING == STD_ON)
+        Os_StackPaint(Os_Configuration.Tasks[TaskId].Stack, Os_Configuration.Tasks[TaskId].StackSize);
+#endif
+    }
+#if (OS_STACK_MONITORING == STD_ON)
+    Os_StackPaint(Os_IdleStack, OS_IDLE_STACK_SIZE);
+#endif
+
+    /* PendSV gets the lowest priority so it only switches after all the ISRs are done */
+    (void)Irq_SetPriority(IRQ_VECTOR_PENDSV, OS_PENDSV_PRIORITY);
+
+    /* Tasks activated before the start are dispatched as soon as the idle loop runs */
+    Disable_Exceptions();
+    Os_CurrentTcb = &Os_IdleTcb;
+    Os_NextTcb    = &Os_IdleTcb;
+    Os_KernelDispatch();
+
+    /* Interrupts are enabled again by Os_CpuStart once the idle stack is in use */
+    Os_CpuStart(&Os_IdleStack[OS_IDLE_STACK_SIZE / 4], IdleLoop);
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_KernelActivateTask(Os_TaskType TaskId)
+{
+    /* Reached from the SysTick ISR and from any ISR through Os_ActivateTask, a higher one
+     * must not activate between the check and the update */
+    uint32 Primask = Os_CpuSaveAndDisable();
+
+    if(Os_TaskTcb[TaskId].State != OS_TASK_SUSPENDED)
+    {
+        /* The previous activation is not finished, the new one is lost */
+        Os_CpuRestore(Primask);
+        return E_NOT_OK;
+    }
+
+    Os_TaskTcb[TaskId].State = OS_TASK_READY;
+    Os_ReadyPriorities |= (uint32)1 << Os_Configuration.Tasks[TaskId].Priority;
+#if (OS_TIMING_PROTECTION == STD_ON)
+    Os_ProtectionActivate(TaskId, Os_KernelGetTickCounter());
+#endif
+    Os_CpuRestore(Primask);
+    return E_OK;
+}
+
+/*********************************************************************************************/
+void Os_KernelDispatch(void)
+{
+    Os_TaskControlBlockType * Tcb = &Os_IdleTcb;
+    Os_TaskType TaskId;
+    uint32 Candidates;
+    uint32 Primask;
+    uint32 * Sp;
+
+    /* Nothing to switch before the kernel is started */
+    if(Os_CurrentTcb == NULL_PTR)
+    {
+        return;
+    }
+
+    /* Also called unmasked from the SysTick ISR, the pick and the frame of the task go together */
+    Primask = Os_CpuSaveAndDisable();
+    Candidates = Os_ReadyPriorities & ~Os_CeilingPriorities;
+    if(Candidates != 0)
+    {
+        TaskId = Os_PriorityTask[Os_CpuHighestBit(Candidates)];
+        Tcb    = &Os_TaskTcb[TaskId];
+
+        if(Tcb->State == OS_TASK_READY)
+        {
+            /* Build the frame PendSV_Handler restores to start the task in Os_TaskWrapper(TaskId) */
+            Sp = (uint32 *)((uint32)(Os_Configuration.Tasks[TaskId].Stack + (Os_Configuration.Tasks[TaskId].StackSize / 4)) & ~(uint32)7);
+            *(--Sp) = OS_INITIAL_XPSR;                          /* xPSR */
+            *(--Sp) = (uint32)Os_TaskWrapper & ~(uint32)1;      /* PC */
+            *(--Sp) = 0;                                        /* LR */
+            *(--Sp) = 0;                                        /* R12 */
+            *(--Sp) = 0;                                        /* R3 */
+            *(--Sp) = 0;                                        /* R2 */
+            *(--Sp) = 0;                                        /* R1 */
+            *(--Sp) = TaskId;                                   /* R0 - argument of Os_TaskWrapper */
+            *(--Sp) = OS_INITIAL_EXC_RETURN;                    /* EXC_RETURN */
+            Sp -= 8;                                            /* R4 - R11 */
+            Tcb->StackPointer = Sp;
+            Tcb->State        = OS_TASK_STARTED;
+        }
+    }
+    else if(Os_CeilingPriorities != 0)
+    {
+        /* No task above the ceiling, the task holding the resources goes on */
+        Tcb = &Os_TaskTcb[Os_CeilingTask];
+    }
+
+    if(Tcb != Os_CurrentTcb)
+    {
+        Os_NextTcb = Tcb;
+        Irq_SetPending(IRQ_VECTOR_PENDSV);
+    }
+    Os_CpuRestore(Primask);
+}
+
+/*********************************************************************************************/
+static void Os_TaskWrapper(Os_TaskType TaskId)
+{
+    uint32 Primask;
+#if (OS_EXECUTION_TIME_MEASUREMENT == STD_ON)
+    Os_TimingContextType Timing;
+#endif
+#if (OS_TIMING_PROTECTION == STD_ON)
+    Os_ProtectionContextType Protection;
+#endif
+
+#if (OS_CPU_LOAD_MEASUREMENT == STD_ON)
+    /* The task may have preempted the idle loop */
+    Os_KernelIdleEnd();
+#endif
+    OS_TRACE_TASK_START(TaskId);
+#if (OS_TIMING_PROTECTION == STD_ON)
+    Os_ProtectionTaskStart(TaskId, &Protection);
+#endif
+#if (OS_EXECUTION_TIME_MEASUREMENT == STD_ON)
+    Os_TimingStart(&Timing);
+    Os_Configuration.Tasks[TaskId].Entry();
+    Os_TimingStop(TaskId, &Timing);
+#else
+    Os_Configuration.Tasks[TaskId].Entry();
+#endif
+#if (OS_TIMING_PROTECTION == STD_ON)
+    Os_ProtectionTaskEnd(TaskId, &Protection);
+#endif
+#if (OS_LET == STD_ON)
+    Os_LetTaskEnd(TaskId);
+#endif
+#if (OS_RESOURCE_COUNT > 0U)
+    Os_ResourceTaskEnd(TaskId);
+#endif
+    OS_TRACE_TASK_END(TaskId);
+
+    /* Terminate the task and give the CPU to the next ready task or to the idle loop */
+    Primask = Os_CpuSaveAndDisable();
+    Os_TaskTcb[TaskId].State = OS_TASK_SUSPENDED;
+    Os_ReadyPriorities &= ~((uint32)1 << Os_Configuration.Tasks[TaskId].Priority);
+    Os_KernelDispatch();
+    Os_CpuRestore(Primask);
+
+    /* PendSV switches away before this point is reached, this context is never resumed */
+    while(1)
+    {
+    }
+}
+
+/*********************************************************************************************/
+Os_TaskType Os_KernelGetRunningTask(void)
+{
+    Os_TaskType TaskId = OS_TASK_COUNT;
+
+    /* The ISRs run on top of the task Os_CurrentTcb points to */
+    if((Os_CurrentTcb != NULL_PTR) && (Os_CurrentTcb != &Os_IdleTcb) && (Os_CpuActiveIrq() == OS_CPU_THREAD_MODE))
+    {
+        TaskId = (Os_TaskType)(Os_CurrentTcb - Os_TaskTcb);
+    }
+    return TaskId;
+}
+
+#if (OS_RESOURCE_COUNT > 0U)
+/*********************************************************************************************/
+void Os_KernelGetResource(Os_ResourceType ResId)
+{
+    Os_ResourceSavedPriorities[ResId] = Os_CeilingPriorities;
+    Os_ResourceSavedTask[ResId]       = Os_CeilingTask;
+
+    /* Block all the levels up to the ceiling, the running task is below it */
+    Os_CeilingPriorities |= ((uint32)2 << Os_Configuration.Resources[ResId].Ceiling) - 1U;
+    Os_CeilingTask        = (Os_TaskType)(Os_CurrentTcb - Os_TaskTcb);
+}
+
+/*********************************************************************************************/
+void Os_KernelReleaseResource(Os_ResourceType ResId)
+{
+    Os_CeilingPriorities = Os_ResourceSavedPriorities[ResId];
+    Os_CeilingTask       = Os_ResourceSavedTask[ResId];
+    Os_KernelDispatch();
+}
+#endif
+
+#endif /* (OS_SCHEDULING_MODE == OS_SCHEDULING_PREEMPTIVE) */
+
+#if (OS_SCHEDULING_MODE == OS_SCHEDULING_NVIC)
+
+#if (OS_TASK_COUNT > OS_TASK_IRQ_COUNT)
+#error "Os: the NVIC scheduling mode supports up to 7 tasks"
+#endif
+
+#if (OS_RESOURCE_COUNT > 0U)
+/* BASEPRI before every resource held was occupied */
+static uint32 Os_ResourceSavedBasepri[OS_RESOURCE_COUNT];
+#endif
+
+/*********************************************************************************************/
+void Os_KernelStart(void (*IdleLoop)(void))
+{
+    Os_TaskType TaskId;
+
+    /* The generator keeps all the task levels below SysTick so the tick always preempts the tasks */
+    for(TaskId = 0; TaskId < OS_TASK_COUNT; TaskId++)
+    {
+        (void)Irq_SetPriority(IRQ_VECTOR(OS_TASK_IRQ_BASE + TaskId), Os_Configuration.Tasks[TaskId].IrqPriority);
+    }
+
+    /* Tasks activated before the start are still pending and run as soon as their IRQ is enabled */
+    for(TaskId = 0; TaskId < OS_TASK_COUNT; TaskId++)
+    {
+        Irq_EnableInterrupt(IRQ_VECTOR(OS_TASK_IRQ_BASE + TaskId));
+    }
+
+    /* Thread mode keeps running on the main stack as the idle loop */
+    IdleLoop();
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_KernelActivateTask(Os_TaskType TaskId)
+{
+    Irq_VectorType Vector = IRQ_VECTOR(OS_TASK_IRQ_BASE + TaskId);
+    uint32 Primask;
+
+    /* A higher ISR must not activate the task between the check and the pend */
+    Primask = Os_CpuSaveAndDisable();
+    if((TRUE == Irq_GetPending(Vector)) || (TRUE == Irq_GetActive(Vector)))
+    {
+        /* The previous activation is still pending or running (possibly preempted), the new one is lost */
+        Os_CpuRestore(Primask);
+        return E_NOT_OK;
+    }
+
+    Irq_SetPending(Vector);
+#if (OS_TIMING_PROTECTION == STD_ON)
+    Os_ProtectionActivate(TaskId, Os_KernelGetTickCounter());
+#endif
+    Os_CpuRestore(Primask);
+    return E_OK;
+}
+
+/*********************************************************************************************/
+Os_TaskType Os_KernelGetRunningTask(void)
+{
+    uint32 Irq = Os_CpuActiveIrq();
+
+    /* Thread mode (idle loop), system exceptions and the other IRQs are no task */
+    if((Irq >= OS_TASK_IRQ_BASE) && (Irq < (OS_TASK_IRQ_BASE + OS_TASK_COUNT)))
+    {
+        return (Os_TaskType)(Irq - OS_TASK_IRQ_BASE);
+    }
+    return OS_TASK_COUNT;
+}
+
+#if (OS_RESOURCE_COUNT > 0U)
+/*********************************************************************************************/
+void Os_KernelGetResource(Os_ResourceType ResId)
+{
+    /* Mask the IRQs of all the tasks using the resource, the NVIC keeps them pending */
+    Os_ResourceSavedBasepri[ResId] =
+        Os_CpuRaiseBasepri((uint32)Os_Configuration.Resources[ResId].IrqCeiling << IRQ_PRIORITY_BITS_POS);
+}
+
+/*********************************************************************************************/
+void Os_KernelReleaseResource(Os_ResourceType ResId)
+{
+    Os_CpuSetBasepri(Os_ResourceSavedBasepri[ResId]);
+}
+#endif
+
+/*********************************************************************************************/
+void Os_TaskIrqHandler(void)
+{
+    Os_TaskType TaskId = (Os_TaskType)(Os_CpuActiveIrq() - OS_TASK_IRQ_BASE);
+#if (OS_EXECUTION_TIME_MEASUREMENT == STD_ON)
+    Os_TimingContextType Timing;
+#endif
+#if (OS_TIMING_PROTECTION == STD_ON)
+    Os_ProtectionContextType Protection;
+#endif
+
+    /*
+     * Run to completion: a task only returns to the context it preempted, so the
+     * frames of the tasks nest on the main stack and one stack frame per
+     * preemption level is the worst case (stack resource policy).
+     */
+#if (OS_CPU_LOAD_MEASUREMENT == STD_ON)
+    /* The task may have preempted the idle loop */
+    Os_KernelIdleEnd();
+#endif
+    OS_TRACE_TASK_START(TaskId);
+#if (OS_TIMING_PROTECTION == STD_ON)
+    Os_ProtectionTaskStart(TaskId, &Protection);
+#endif
+#if (OS_EXECUTION_TIME_MEASUREMENT == STD_ON)
+    Os_TimingStart(&Timing);
+    Os_Configuration.Tasks[TaskId].Entry();
+    Os_TimingStop(TaskId, &Timing);
+#else
+    Os_Configuration.Tasks[TaskId].Entry();
+#endif
+#if (OS_TIMING_PROTECTION == STD_ON)
+    Os_ProtectionTaskEnd(TaskId, &Protection);
+#endif
+#if (OS_LET == STD_ON)
+    Os_LetTaskEnd(TaskId);
+#endif
+#if (OS_RESOURCE_COUNT > 0U)
+    Os_ResourceTaskEnd(TaskId);
+#endif
+    OS_TRACE_TASK_END(TaskId);
+}
+
+#else
+
+/*********************************************************************************************/
+void Os_TaskIrqHandler(void)
+{
+    /* The task IRQs are never enabled outside of the NVIC mode */
+    while(1)
+    {
+    }
+}
+
+#endif /* (OS_SCHEDULING_MODE == OS_SCHEDULING_NVIC) */
@@ -0,0 +1,313 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Kernel.h
+ *
+ * Description: Internal header file shared by the Os source files and the
+ *              SchM exclusive areas built on the Os (not to be included by
+ *              other modules).
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#ifndef OS_KERNEL_H_
+#define OS_KERNEL_H_
+
+#include "Os.h"
+
+/* Enable Exceptions ... This Macro enable IRQ interrupts, Programmable Systems Exceptions and Faults by clearing the I-bit in the PRIMASK. */
+#define Enable_Exceptions()    __asm(" CPSIE I ")
+
+/* Disable Exceptions ... This Macro disable IRQ interrupts, Programmable Systems Exceptions and Faults by setting the I-bit in the PRIMASK. */
+#define Disable_Exceptions()   __asm(" CPSID I ")
+
+/* Enable Faults ... This Macro enable Faults by clearing the F-bit in the FAULTMASK */
+#define Enable_Faults()        __asm(" CPSIE F ")
+
+/* Disable Faults ... This Macro disable Faults by setting the F-bit in the FAULTMASK */
+#define Disable_Faults()       __asm(" CPSID F ")
+
+/* Wait For Interrupt ... This Macro puts the CPU in sleep mode until an interrupt is pending, it wakes up even if the I-bit in the PRIMASK is set. */
+#define Wait_For_Interrupt()   __asm(" WFI ")
+
+/* Data Memory Barrier ... This Macro completes the memory accesses before it ahead of the ones after it, in the code and on the bus. */
+#define Data_Memory_Barrier()  __asm(" DMB ")
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Value of Os_CpuActiveIrq in Thread mode (IPSR 0) */
+#define OS_CPU_THREAD_MODE         ((uint32)-16)
+
+/* Pattern of the unused stack words, painted by ResetISR and Os_KernelStart */
+#define OS_STACK_PAINT_PATTERN     (0xA5A5A5A5UL)
+
+/* Description: Structure to hold the context of a task in the preemptive mode */
+typedef struct
+{
+    /* Saved process stack pointer, it must stay the first member as PendSV_Handler uses it */
+    uint32 * StackPointer;
+    /* Task state: suspended, ready or started */
+    uint8 State;
+} Os_TaskControlBlockType;
+
+/* Description: Structure to hold the measurement of one task run in progress */
+typedef struct
+{
+    /* Timestamp of the start of the run */
+    uint32 Start;
+    /* Preemption time accumulated by the context the task preempted */
+    uint32 Preempted;
+} Os_TimingContextType;
+
+/* Description: Structure to hold the budget of the task preempted by a task run in progress */
+typedef struct
+{
+    /* Task whose budget was running, OS_TASK_COUNT if none */
+    Os_TaskType Task;
+    /* Budget expiries already reported for its run */
+    uint8 Expiries;
+    /* Cycles left of its budget */
+    uint32 Remaining;
+} Os_ProtectionContextType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Description: Os.c - Get the number of ticks counted since the Os started */
+uint32 Os_KernelGetTickCounter(void);
+
+/* Description: Get the task running at the moment (innermost one), OS_TASK_COUNT outside of the tasks */
+Os_TaskType Os_KernelGetRunningTask(void);
+
+/* Description: Os.c - Os_ActivateTask for the callers already running from an ISR or with interrupts disabled */
+Std_ReturnType Os_KernelActivateEvent(Os_TaskType TaskId);
+
+#if (OS_ALARMS == STD_ON)
+
+/* Description: Os_Alarm.c - Advance the timing wheel up to the tick counter, called by the tick */
+void Os_AlarmTick(uint32 TickCounter);
+
+/*
+ * Description: Os_Alarm.c - Get the number of ticks until the first tick that expires an alarm,
+ *              0 if expired alarms are waiting and 0xFFFFFFFF if no alarm is running.
+ */
+uint32 Os_AlarmGetIdleTicks(void);
+
+#endif
+
+#if (OS_APERIODIC_SERVER == STD_ON)
+
+/* Description: Os_Server.c - Convert the budget of the aperiodic server to timestamp cycles */
+void Os_ServerInit(void);
+
+/* Description: Os_Server.c - Give back the budget due on this tick, called by the tick */
+void Os_ServerTick(uint32 TickCounter);
+
+/*
+ * Description: Os_Server.c - Get the number of ticks until the replenishment an exhausted server with
+ *              waiting jobs needs, 0xFFFFFFFF if none.
+ */
+uint32 Os_ServerGetIdleTicks(uint32 TickCounter);
+
+#endif
+
+/* Description: Os_Cpu.asm - Get the index of the most significant bit set in a non zero value */
+uint32 Os_CpuHighestBit(uint32 Value);
+
+/*
+ * Description: Os_Cpu.asm - Disable the interrupts and return the previous PRIMASK, for the
+ *              critical sections that can also be entered with interrupts already disabled.
+ */
+uint32 Os_CpuSaveAndDisable(void);
+
+/* Description: Os_Cpu.asm - Restore the PRIMASK returned by Os_CpuSaveAndDisable */
+void Os_CpuRestore(uint32 Primask);
+
+/*
+ * Description: Os_Cpu.asm - Mask the interrupts with a priority value of Basepri (already shifted
+ *              in the implemented bits) and above, unless a stricter level is already set.
+ *              Returns the previous BASEPRI.
+ */
+uint32 Os_CpuRaiseBasepri(uint32 Basepri);
+
+/* Description: Os_Cpu.asm - Restore the BASEPRI returned by Os_CpuRaiseBasepri */
+void Os_CpuSetBasepri(uint32 Basepri);
+
+/*
+ * Description: Os_Cpu.asm - Store Desired at Address if it still holds Expected, as one atomic step
+ *              (LDREX/STREX). Returns TRUE if stored, FALSE if Address changed meanwhile.
+ */
+boolean Os_CpuCompareAndSwap(volatile uint32 * Address, uint32 Expected, uint32 Desired);
+
+/* The cycle timestamps are shared by the execution times, the CPU load, the trace and the aperiodic server */
+#if (OS_EXECUTION_TIME_MEASUREMENT == STD_ON) || (OS_CPU_LOAD_MEASUREMENT == STD_ON) || (OS_TRACE == STD_ON) || \
+    (OS_APERIODIC_SERVER == STD_ON)
+#define OS_TIMESTAMPS                  (STD_ON)
+#else
+#define OS_TIMESTAMPS                  (STD_OFF)
+#endif
+
+#if (OS_TIMESTAMPS == STD_ON)
+
+/* Description: Start the timestamp counter, the DWT cycle counter if present */
+void Os_TimingInit(void);
+
+/* Description: Get the current timestamp in clock cycles, called with interrupts disabled */
+uint32 Os_TimingGetTimestamp(void);
+
+#endif
+
+#if (OS_CPU_LOAD_MEASUREMENT == STD_ON)
+
+/* Description: Os_CpuLoad.c - Report the start / the end of an idle period of the scheduler at the current time */
+void Os_KernelIdleStart(void);
+void Os_KernelIdleEnd(void);
+
+/*
+ * Description: Os_CpuLoad.c - Calculation of the CPU load from timestamps in clock cycles.
+ *              Called from the tick ISR or with interrupts disabled.
+ */
+void Os_CpuLoadIdleStart(uint32 Timestamp);
+void Os_CpuLoadIdleEnd(uint32 Timestamp);
+void Os_CpuLoadTick(uint32 Timestamp, uint32 TickCounter);
+
+#endif
+
+#if (OS_TRACE == STD_ON)
+
+/* Description: Os_Trace.c - Complete the header of the recorder once the tick period is known */
+void Os_TraceInit(void);
+
+#endif
+
+#if (OS_EXECUTION_TIME_MEASUREMENT == STD_ON)
+
+/* Description: Start the measurement of a task run, called by the task context before the entry */
+void Os_TimingStart(Os_TimingContextType * Context);
+
+/* Description: Stop the measurement of a task run and add it to the statistics of the task */
+void Os_TimingStop(Os_TaskType TaskId, const Os_TimingContextType * Context);
+
+#endif
+
+#if (OS_TIMING_PROTECTION == STD_ON)
+
+/* Description: Os_Protection.c - Start the budget timer, called before the tasks start */
+void Os_ProtectionInit(void);
+
+/* Description: Os_Protection.c - Note the tick a task was activated on, for its deadline */
+void Os_ProtectionActivate(Os_TaskType TaskId, uint32 Tick);
+
+/* Description: Os_Protection.c - Check if the next scheduled activation of a task has to be dropped (and forget it) */
+boolean Os_ProtectionSkipActivation(Os_TaskType TaskId);
+
+/*
+ * Description: Os_Protection.c - Start the budget of a task run and pause the budget of the
+ *              context it preempted / stop it, resume the preempted one and check the deadline.
+ *              Called by the task context around the entry.
+ */
+void Os_ProtectionTaskStart(Os_TaskType TaskId, Os_ProtectionContextType * Context);
+void Os_ProtectionTaskEnd(Os_TaskType TaskId, const Os_ProtectionContextType * Context);
+
+#endif
+
+/*
+ * Description: Os.c - Get the schedule starting on the hyperperiod boundary at this tick counter
+ *              value. The first caller on a boundary takes the request of Os_SwitchSchedule, the
+ *              scheduler and the LET ticks reach it at different times but run the same schedule.
+ */
+const Os_ScheduleTableType * Os_KernelGetBoundarySchedule(uint32 Tick);
+
+#if (OS_LET == STD_ON)
+
+/*
+ * Description: Os_Let.c - Publish the outputs of the tasks whose period ends on this tick and latch
+ *              the inputs of the tasks released on it, called by the tick ISR
+ */
+void Os_LetTick(uint32 TickCounter);
+
+/* Description: Os_Let.c - Mark the run of a task finished, its outputs are published at the end of the period */
+void Os_LetTaskEnd(Os_TaskType TaskId);
+
+#endif
+
+/* Description: Os_Protection.c - Budget timer ISR (vector table), it reports the budget overruns */
+void Os_ProtectionTimerHandler(void);
+
+/*
+ * Description: Handler of the spare IRQs used as tasks in the NVIC mode (vector table), it runs
+ *              the task mapped to the active IRQ.
+ */
+void Os_TaskIrqHandler(void);
+
+#if (OS_SCHEDULING_MODE != OS_SCHEDULING_COOPERATIVE)
+
+/*
+ * Description: Run the given idle loop as the lowest priority context, the tasks preempt it
+ *              from now on. Never returns.
+ */
+void Os_KernelStart(void (*IdleLoop)(void));
+
+/*
+ * Description: Make a suspended task ready to run. Returns E_NOT_OK if the task is still
+ *              active from its previous activation. Called with interrupts disabled or from an ISR.
+ */
+Std_ReturnType Os_KernelActivateTask(Os_TaskType TaskId);
+
+#endif
+
+#if (OS_RESOURCE_COUNT > 0U)
+
+/* Description: Os_Resource.c - Mark all the resources free, called before the tasks start */
+void Os_ResourceInit(void);
+
+/* Description: Os_Resource.c - Check that a task ending released all its resources, called by the task context */
+void Os_ResourceTaskEnd(Os_TaskType TaskId);
+
+#if (OS_SCHEDULING_MODE != OS_SCHEDULING_COOPERATIVE)
+
+/*
+ * Description: Raise the running task to the ceiling of a resource / restore the priority it had
+ *              before. Called with interrupts disabled, in the order of the resource LIFO.
+ */
+void Os_KernelGetResource(Os_ResourceType ResId);
+void Os_KernelReleaseResource(Os_ResourceType ResId);
+
+#endif
+
+#endif
+
+/* Description: Os_Cpu.asm - Get the number of the IRQ being served (IPSR - 16) */
+uint32 Os_CpuActiveIrq(void);
+
+#if (OS_STACK_MONITORING == STD_ON)
+
+/* Description: Os_Stack.c - Paint a stack that is not in use yet */
+void Os_StackPaint(uint32 * Stack, uint32 Size);
+
+/* Description: Os_Stack.c - Check the canary words at the bottom of all the stacks, called by the tick */
+void Os_StackCheck(void);
+
+#endif
+
+#if (OS_SCHEDULING_MODE == OS_SCHEDULING_PREEMPTIVE)
+
+/* Description: Os_Kernel.c - Stack of the idle loop in the preemptive mode */
+extern uint32 Os_IdleStack[OS_IDLE_STACK_SIZE / 4];
+
+/*
+ * Description: Request a context switch through PendSV if a higher priority task than the
+ *              running one is ready. Called with interrupts disabled or from an ISR.
+ */
+void Os_KernelDispatch(void);
+
+/* Description: Os_Cpu.asm - Set the process stack, switch Thread mode to it and branch to Entry */
+void Os_CpuStart(uint32 * StackTop, void (*Entry)(void));
+
+#endif
+
+#endif /* OS_KERNEL_H_ */
@@ -0,0 +1,134 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Let.c
+ *
+ * Description: Source file for the logical execution time of the Os Scheduler.
+ *              The I/O of a periodic task is moved out of its run to the tick
+ *              ISR: its inputs are latched at the release of the task and the
+ *              outputs of the run are published at the end of the period, so
+ *              the I/O instants do not move with the execution times or the
+ *              scheduling of the tasks. The boundaries follow the real ticks,
+ *              not the scheduler which may process them late.
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#include "Os_Kernel.h"
+
+#if (OS_LET == STD_ON)
+
+/* Schedule followed by the ticks, switched on the hyperperiod boundaries like the scheduler */
+static const Os_ScheduleTableType * g_Let_Schedule = &Os_Configuration.Schedules[0];
+
+/* Tick counter value of the last tick seen */
+static uint32 g_Let_Tick_Counter = 0;
+
+/* Tick inside the hyperperiod of the next tick */
+static uint16 g_Let_Time_Tick = 0;
+
+/* Index of the next expiry point of the schedule reached by the ticks */
+static uint16 g_Let_Expiry_Point_Index = 0;
+
+/* One bit per task released at its last expiry point */
+static uint32 g_Let_Released = 0;
+
+/* One bit per released task whose run has finished since the release */
+static uint32 g_Let_Finished = 0;
+
+/* Periods every task did not finish in */
+static uint32 g_Let_Violation_Count[OS_TASK_COUNT];
+
+/*********************************************************************************************/
+void Os_LetTick(uint32 TickCounter)
+{
+    const Os_ScheduleTableType * Schedule = g_Let_Schedule;
+    const Os_ExpiryPointType * ExpiryPoint = &Schedule->ExpiryPoints[g_Let_Expiry_Point_Index];
+    const Os_TaskConfigType * Task;
+    Os_TaskType TaskId;
+    uint16 TaskIndex;
+    uint16 Tick;
+    uint32 Mask;
+
+    /* The ticks suppressed by the tickless idle hold no expiry point but still move the schedule */
+    Tick = (uint16)((g_Let_Time_Tick + (TickCounter - g_Let_Tick_Counter) - 1U) % Schedule->Hyperperiod);
+    g_Let_Tick_Counter = TickCounter;
+    g_Let_Time_Tick = Tick + 1U;
+    if(g_Let_Time_Tick == Schedule->Hyperperiod)
+    {
+        /* The expiry points of this tick are still the ones of the ending schedule */
+        g_Let_Time_Tick = 0;
+        g_Let_Schedule = Os_KernelGetBoundarySchedule(TickCounter + 1U);
+    }
+
+    if(ExpiryPoint->Offset != Tick)
+    {
+        return;
+    }
+
+    /* All the outputs of the tick are published before any input is latched, a task released on
+     * the tick reads the outputs of the periods ending on it */
+    for(TaskIndex = ExpiryPoint->FirstTask; TaskIndex < (ExpiryPoint + 1)->FirstTask; TaskIndex++)
+    {
+        TaskId = Schedule->ExpiryTasks[TaskIndex];
+        Task = &Os_Configuration.Tasks[TaskId];
+        Mask = (uint32)1 << TaskId;
+        if(g_Let_Released & Mask)
+        {
+            if(g_Let_Finished & Mask)
+            {
+                if(Task->LetOutput != NULL_PTR)
+                {
+                    Task->LetOutput();
+                }
+            }
+            else
+            {
+                /* The outputs keep their last values, the late run publishes at the end of the
+                 * period it finishes in */
+                g_Let_Violation_Count[TaskId]++;
+            }
+        }
+    }
+
+    for(TaskIndex = ExpiryPoint->FirstTask; TaskIndex < (ExpiryPoint + 1)->FirstTask; TaskIndex++)
+    {
+        TaskId = Schedule->ExpiryTasks[TaskIndex];
+        Task = &Os_Configuration.Tasks[TaskId];
+        if(Task->LetInput != NULL_PTR)
+        {
+            Task->LetInput();
+        }
+        g_Let_Released |= (uint32)1 << TaskId;
+        g_Let_Finished &= ~((uint32)1 << TaskId);
+    }
+
+    g_Let_Expiry_Point_Index++;
+    if(g_Let_Expiry_Point_Index == Schedule->ExpiryPointCount)
+    {
+        g_Let_Expiry_Point_Index = 0;
+    }
+}
+
+/*********************************************************************************************/
+void Os_LetTaskEnd(Os_TaskType TaskId)
+{
+    uint32 Primask = Os_CpuSaveAndDisable();
+
+    /* Only a released periodic task has outputs to publish */
+    g_Let_Finished |= g_Let_Released & ((uint32)1 << TaskId);
+    Os_CpuRestore(Primask);
+}
+
+/*********************************************************************************************/
+uint32 Os_GetLetViolationCount(Os_TaskType TaskId)
+{
+    if(TaskId >= OS_TASK_COUNT)
+    {
+        return 0;
+    }
+    return g_Let_Violation_Count[TaskId];
+}
+
+#endif /* (OS_LET == STD_ON) */
@@ -0,0 +1,91 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_PBcfg.c
+ *
+ * Description: Post Build Configuration Source file for Os Scheduler.
+ *              Generated by Tools/Os_Gen.py from Os_Cfg.json - do not edit.
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#include "Os.h"
+#include "App.h"
+#include "Button.h"
+#include "Led.h"
+#include "Os_Server.h"
+
+/*
+ * Expiry points of the Normal schedule, one per tick that activates tasks.
+ * The last entry marks the end of the task list of the previous one.
+ */
+static const Os_ExpiryPointType Os_ExpiryPoints_Normal[3U] = {
+    {     0U,     0U },  /*      0 ms,    100 us */
+    {     1U,     2U },  /*     20 ms,     60 us */
+    {     2U,     3U }
+};
+
+/* Tasks activated by each expiry point of the Normal schedule, in dispatch order */
+static const Os_TaskType Os_ExpiryTasks_Normal[3U] = {
+    OsConf_BUTTON_TASK_ID, OsConf_LED_TASK_ID,
+    OsConf_BUTTON_TASK_ID
+};
+
+/*
+ * Expiry points of the Degraded schedule, one per tick that activates tasks.
+ * The last entry marks the end of the task list of the previous one.
+ */
+static const Os_ExpiryPointType Os_ExpiryPoints_Degraded[5U] = {
+    {     0U,     0U },  /*      0 ms,     60 us */
+    {     1U,     1U },  /*     20 ms,     40 us */
+    {     2U,     2U },  /*     40 ms,     60 us */
+    {     4U,     3U },  /*     80 ms,     60 us */
+    {     6U,     4U }
+};
+
+/* Tasks activated by each expiry point of the Degraded schedule, in dispatch order */
+static const Os_TaskType Os_ExpiryTasks_Degraded[4U] = {
+    OsConf_BUTTON_TASK_ID,
+    OsConf_LED_TASK_ID,
+    OsConf_BUTTON_TASK_ID,
+    OsConf_BUTTON_TASK_ID
+};
+
+/*
+ * Expiry points of the LowPower schedule, one per tick that activates tasks.
+ * The last entry marks the end of the task list of the previous one.
+ */
+static const Os_ExpiryPointType Os_ExpiryPoints_LowPower[2U] = {
+    {     0U,     0U },  /*      0 ms,     60 us */
+    {     3U,     1U }
+};
+
+/* Tasks activated by each expiry point of the LowPower schedule, in dispatch order */
+static const Os_TaskType Os_ExpiryTasks_LowPower[1U] = {
+    OsConf_BUTTON_TASK_ID
+};
+
+/* Slots of the Ioc queues, and the slot ready flags of the multi-producer ones */
+#pragma DATA_ALIGN(Os_IocBuffer_Button_Events, 4)
+static uint8 Os_IocBuffer_Button_Events[8U * 1U];
+
+/* PB structure used by the Os Scheduler */
+const Os_ConfigType Os_Configuration = {
+    {
+        { Button_Task, 1U, 0U, 2U, 500U, 1U, Button_LatchInput, NULL_PTR },
+        { Led_Task, 2U, 0U, 0U, 500U, 2U, NULL_PTR, Led_CommitOutput },
+        { Os_ServerTask, 0U, 0U, 1U, 0U, 1U, NULL_PTR, NULL_PTR }
+    },
+    {
+        { Os_ExpiryPoints_Normal, Os_ExpiryTasks_Normal, 2U, 2U },
+        { Os_ExpiryPoints_Degraded, Os_ExpiryTasks_Degraded, 4U, 6U },
+        { Os_ExpiryPoints_LowPower, Os_ExpiryTasks_LowPower, 1U, 3U }
+    },
+    {
+        { 2U }  /* Button_State: Button_Task, Os_ServerTask */
+    },
+    {
+        { Os_IocBuffer_Button_Events, NULL_PTR, 1U, 8U }
+    }
+};
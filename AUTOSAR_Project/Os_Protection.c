@@ -0,0 +1,292 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Protection.c
+ *
+ * Description: Source file for the timing protection of the Os Scheduler. A
+ *              one-shot compare on Wide Timer 5A counts down the execution
+ *              budget of the running task, paused while the task is preempted
+ *              by other tasks (the ISRs are charged to it). On expiry and on a
+ *              missed deadline the protection hook of the application decides
+ *              the reaction: ignore, drop the next activation or reset.
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#include "Os_Kernel.h"
+#include "Gpt.h"
+#include "Irq.h"
+#include "tm4c123gh6pm_registers.h"
+
+#if (OS_TIMING_PROTECTION == STD_ON)
+
+/* Clock gating and peripheral ready bit of Wide Timer 5 */
+#define OS_WTIMER5_MASK            0x20
+
+/* GPTMCFG: the wide timer runs as two independent 32-bit timers */
+#define OS_BUDGET_CFG_32_BIT       0x04
+
+/* GPTMTAMR: one-shot mode, counting down */
+#define OS_BUDGET_TAMR_ONE_SHOT    0x01
+
+/* GPTMCTL timer A enable and GPTMIMR/RIS/ICR timer A time-out bits */
+#define OS_BUDGET_TAEN_MASK        0x01
+#define OS_BUDGET_TATOIM_MASK      0x01
+
+/* System reset request in the Application Interrupt and Reset Control register */
+#define OS_APINT_VECTKEY           0x05FA0000
+#define OS_APINT_SYSRESREQ_MASK    0x00000004
+
+/* Budget of every task in timer cycles, 0 for no budget */
+static uint32 g_Budget_Cycles[OS_TASK_COUNT];
+
+/* Task whose budget is counted by the timer, OS_TASK_COUNT if none */
+static Os_TaskType g_Budget_Task = OS_TASK_COUNT;
+
+/* Budget expiries reported for the current run of g_Budget_Task */
+static uint8 g_Budget_Expiries = 0;
+
+/* Tick counter value every task was last activated on */
+static uint32 g_Activation_Tick[OS_TASK_COUNT];
+
+/* One bit per task whose next scheduled activation is dropped */
+static uint32 g_Skip_Activations = 0;
+
+/* Timing protection errors of every task */
+static Os_ProtectionStatusType g_Protection_Status[OS_TASK_COUNT];
+
+static void Os_BudgetTimerStart(uint32 Cycles);
+static uint32 Os_BudgetTimerStop(void);
+static void Os_ProtectionReact(Os_TaskType TaskId, Os_ProtectionErrorType Error);
+
+/*********************************************************************************************/
+void Os_ProtectionInit(void)
+{
+    Os_TaskType TaskId;
+    /* The budget timer runs on the system clock like SysTick */
+    uint32 Tick_Cycles = SysTick_GetTickCycles();
+
+    for(TaskId = 0; TaskId < OS_TASK_COUNT; TaskId++)
+    {
+        g_Budget_Cycles[TaskId] = (uint32)(((uint64)Os_Configuration.Tasks[TaskId].BudgetUs * Tick_Cycles)
+                                           / (OS_BASE_TIME * 1000U));
+        if((g_Budget_Cycles[TaskId] == 0) && (Os_Configuration.Tasks[TaskId].BudgetUs != 0))
+        {
+            g_Budget_Cycles[TaskId] = 1;
+        }
+    }
+
+    SYSCTL_RCGCWTIMER_REG |= OS_WTIMER5_MASK;
+    while((SYSCTL_PRWTIMER_REG & OS_WTIMER5_MASK) == 0)
+    {
+    }
+
+    WTIMER5_CTL_REG  = 0;
+    WTIMER5_CFG_REG  = OS_BUDGET_CFG_32_BIT;
+    WTIMER5_TAMR_REG = OS_BUDGET_TAMR_ONE_SHOT;
+    WTIMER5_ICR_REG  = OS_BUDGET_TATOIM_MASK;
+    WTIMER5_IMR_REG  = OS_BUDGET_TATOIM_MASK;
+
+    /* OS_BUDGET_IRQ_PRIORITY: above SysTick, the tasks and the SchM exclusive areas */
+    (void)Irq_SetPriority(IRQ_VECTOR(OS_BUDGET_IRQ), OS_BUDGET_IRQ_PRIORITY);
+    Irq_EnableInterrupt(IRQ_VECTOR(OS_BUDGET_IRQ));
+}
+
+/*********************************************************************************************/
+static void Os_BudgetTimerStart(uint32 Cycles)
+{
+    WTIMER5_CTL_REG   = 0;
+    WTIMER5_TAILR_REG = Cycles;
+    WTIMER5_TAV_REG   = Cycles;
+    WTIMER5_CTL_REG   = OS_BUDGET_TAEN_MASK;
+}
+
+/*********************************************************************************************/
+static uint32 Os_BudgetTimerStop(void)
+{
+    uint32 Remaining;
+
+    WTIMER5_CTL_REG = 0;
+    Remaining = WTIMER5_TAV_REG;
+
+    if(WTIMER5_RIS_REG & OS_BUDGET_TATOIM_MASK)
+    {
+        /* Expired just now and the ISR is still pending: the expiry is handled by the caller */
+        WTIMER5_ICR_REG = OS_BUDGET_TATOIM_MASK;
+        Irq_ClearPending(IRQ_VECTOR(OS_BUDGET_IRQ));
+        Remaining = 0;
+    }
+    return Remaining;
+}
+
+/*********************************************************************************************/
+void Os_ProtectionActivate(Os_TaskType TaskId, uint32 Tick)
+{
+    g_Activation_Tick[TaskId] = Tick;
+}
+
+/*********************************************************************************************/
+boolean Os_ProtectionSkipActivation(Os_TaskType TaskId)
+{
+    boolean Skip = FALSE;
+    uint32 Primask = Os_CpuSaveAndDisable();
+
+    if(g_Skip_Activations & ((uint32)1 << TaskId))
+    {
+        g_Skip_Activations &= ~((uint32)1 << TaskId);
+        g_Protection_Status[TaskId].SkippedActivations++;
+        Skip = TRUE;
+    }
+    Os_CpuRestore(Primask);
+    return Skip;
+}
+
+/*********************************************************************************************/
+void Os_ProtectionTaskStart(Os_TaskType TaskId, Os_ProtectionContextType * Context)
+{
+    uint32 Primask = Os_CpuSaveAndDisable();
+
+    /* Pause the budget of the preempted task, the tasks run to completion so the budgets nest */
+    Context->Task      = g_Budget_Task;
+    Context->Expiries  = g_Budget_Expiries;
+    Context->Remaining = 0;
+    if(g_Budget_Task != OS_TASK_COUNT)
+    {
+        Context->Remaining = Os_BudgetTimerStop();
+        if(Context->Remaining == 0)
+        {
+            /* It expires again as soon as it resumes */
+            Context->Remaining = 1;
+        }
+    }
+
+    g_Budget_Task     = OS_TASK_COUNT;
+    g_Budget_Expiries = 0;
+    if(g_Budget_Cycles[TaskId] != 0)
+    {
+        g_Budget_Task = TaskId;
+        Os_BudgetTimerStart(g_Budget_Cycles[TaskId]);
+    }
+    Os_CpuRestore(Primask);
+}
+
+/*********************************************************************************************/
+void Os_ProtectionTaskEnd(Os_TaskType TaskId, const Os_ProtectionContextType * Context)
+{
+    uint16 Deadline = Os_Configuration.Tasks[TaskId].Deadline;
+    uint32 Primask = Os_CpuSaveAndDisable();
+
+    /* An expiry in the last instructions of the run is not reported, the run is over */
+    if(g_Budget_Task != OS_TASK_COUNT)
+    {
+        (void)Os_BudgetTimerStop();
+    }
+
+    /* Resume the budget of the preempted task */
+    g_Budget_Task     = Context->Task;
+    g_Budget_Expiries = Context->Expiries;
+    if((g_Budget_Task != OS_TASK_COUNT) && (g_Budget_Expiries < 2U))
+    {
+        Os_BudgetTimerStart(Context->Remaining);
+    }
+    Os_CpuRestore(Primask);
+
+    /* The deadline is checked once the task is done, a task that never ends is caught by its budget */
+    if((Deadline != 0) && ((Os_KernelGetTickCounter() - g_Activation_Tick[TaskId]) >= Deadline))
+    {
+        Primask = Os_CpuSaveAndDisable();
+        g_Protection_Status[TaskId].DeadlineMisses++;
+        Os_CpuRestore(Primask);
+        Os_ProtectionReact(TaskId, OS_PROTECTION_DEADLINE);
+    }
+}
+
+/*********************************************************************************************/
+void Os_ProtectionTimerHandler(void)
+{
+    Os_TaskType TaskId;
+    Os_ProtectionErrorType Error = OS_PROTECTION_BUDGET;
+    uint32 Primask = Os_CpuSaveAndDisable();
+
+    WTIMER5_ICR_REG = OS_BUDGET_TATOIM_MASK;
+    TaskId = g_Budget_Task;
+    if((TaskId != OS_TASK_COUNT) && (g_Budget_Expiries < 2U))
+    {
+        if(g_Budget_Expiries == 0)
+        {
+            /* Give the run one more budget before it is considered stuck */
+            g_Protection_Status[TaskId].BudgetOverruns++;
+            Os_BudgetTimerStart(g_Budget_Cycles[TaskId]);
+        }
+        else
+        {
+            Error = OS_PROTECTION_RUNAWAY;
+        }
+        g_Budget_Expiries++;
+    }
+    else
+    {
+        TaskId = OS_TASK_COUNT;
+    }
+    Os_CpuRestore(Primask);
+
+    if(TaskId != OS_TASK_COUNT)
+    {
+        Os_ProtectionReact(TaskId, Error);
+    }
+}
+
+/*********************************************************************************************/
+static void Os_ProtectionReact(Os_TaskType TaskId, Os_ProtectionErrorType Error)
+{
+    Os_ProtectionReturnType Reaction = OS_PROTECTION_HOOK(TaskId, Error);
+    uint32 Primask;
+
+    if(Reaction == OS_PRO_SKIP_ACTIVATION)
+    {
+        Primask = Os_CpuSaveAndDisable();
+        g_Skip_Activations |= (uint32)1 << TaskId;
+        Os_CpuRestore(Primask);
+    }
+    else if(Reaction == OS_PRO_RESET)
+    {
+        NVIC_SYSTEM_APINT = OS_APINT_VECTKEY | OS_APINT_SYSRESREQ_MASK;
+        while(1)
+        {
+        }
+    }
+    else
+    {
+        /* OS_PRO_IGNORE: the error is only counted */
+    }
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_GetTaskProtectionStatus(Os_TaskType TaskId, Os_ProtectionStatusType * Status)
+{
+    uint32 Primask;
+
+    if((TaskId >= OS_TASK_COUNT) || (Status == NULL_PTR))
+    {
+        return E_NOT_OK;
+    }
+
+    Primask = Os_CpuSaveAndDisable();
+    *Status = g_Protection_Status[TaskId];
+    Os_CpuRestore(Primask);
+    return E_OK;
+}
+
+#else
+
+/*********************************************************************************************/
+void Os_ProtectionTimerHandler(void)
+{
+    /* The budget timer is never enabled without the timing protection */
+    while(1)
+    {
+    }
+}
+
+#endif /* (OS_TIMING_PROTECTION == STD_ON) */
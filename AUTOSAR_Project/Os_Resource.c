@@ -0,0 +1,113 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Resource.c
+ *
+ * Description: Source file for the resources of the Os Scheduler (OSEK
+ *              immediate priority ceiling protocol). The ceilings are computed
+ *              by the generator from the tasks declared as users, a task
+ *              holding a resource can only be preempted by the tasks above the
+ *              ceiling, which never use it: at most one lower priority task
+ *              blocks a task, once, before it starts.
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#include "Os_Kernel.h"
+#include "Det.h"
+
+#if (OS_RESOURCE_COUNT > 0U)
+
+/* Marker of a free resource and of the end of the resource list */
+#define OS_RESOURCE_FREE           OS_TASK_COUNT
+#define OS_RESOURCE_NONE           OS_RESOURCE_COUNT
+
+/* Task holding every resource */
+static Os_TaskType g_Resource_Owner[OS_RESOURCE_COUNT];
+
+/*
+ * Resources held by all the tasks, last occupied first. The tasks preempting a resource holder
+ * release theirs before they end, so the resources of the running task are always on top.
+ */
+static Os_ResourceType g_Resource_Last = OS_RESOURCE_NONE;
+static Os_ResourceType g_Resource_Previous[OS_RESOURCE_COUNT];
+
+/*********************************************************************************************/
+void Os_ResourceInit(void)
+{
+    Os_ResourceType ResId;
+
+    for(ResId = 0; ResId < OS_RESOURCE_COUNT; ResId++)
+    {
+        g_Resource_Owner[ResId] = OS_RESOURCE_FREE;
+    }
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_GetResource(Os_ResourceType ResId)
+{
+    Std_ReturnType Status = E_NOT_OK;
+    Os_TaskType TaskId;
+    uint32 Primask;
+
+    if(ResId >= OS_RESOURCE_COUNT)
+    {
+        return E_NOT_OK;
+    }
+
+    Primask = Os_CpuSaveAndDisable();
+    TaskId = Os_KernelGetRunningTask();
+    if((TaskId < OS_TASK_COUNT) && (g_Resource_Owner[ResId] == OS_RESOURCE_FREE) &&
+       (Os_Configuration.Tasks[TaskId].Priority <= Os_Configuration.Resources[ResId].Ceiling))
+    {
+        g_Resource_Owner[ResId]    = TaskId;
+        g_Resource_Previous[ResId] = g_Resource_Last;
+        g_Resource_Last            = ResId;
+#if (OS_SCHEDULING_MODE != OS_SCHEDULING_COOPERATIVE)
+        Os_KernelGetResource(ResId);
+#endif
+        Status = E_OK;
+    }
+    Os_CpuRestore(Primask);
+    return Status;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_ReleaseResource(Os_ResourceType ResId)
+{
+    Std_ReturnType Status = E_NOT_OK;
+    uint32 Primask;
+
+    if(ResId >= OS_RESOURCE_COUNT)
+    {
+        return E_NOT_OK;
+    }
+
+    Primask = Os_CpuSaveAndDisable();
+    if((g_Resource_Last == ResId) && (g_Resource_Owner[ResId] == Os_KernelGetRunningTask()))
+    {
+        g_Resource_Owner[ResId] = OS_RESOURCE_FREE;
+        g_Resource_Last         = g_Resource_Previous[ResId];
+#if (OS_SCHEDULING_MODE != OS_SCHEDULING_COOPERATIVE)
+        /* The tasks blocked by the ceiling preempt as soon as the interrupts are enabled again */
+        Os_KernelReleaseResource(ResId);
+#endif
+        Status = E_OK;
+    }
+    Os_CpuRestore(Primask);
+    return Status;
+}
+
+/*********************************************************************************************/
+void Os_ResourceTaskEnd(Os_TaskType TaskId)
+{
+    /* The resources of the ending task are on top of the list */
+    if((g_Resource_Last != OS_RESOURCE_NONE) && (g_Resource_Owner[g_Resource_Last] == TaskId))
+    {
+        /* Its ceiling would stay raised and block the other users forever */
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_TERMINATE_TASK_SID, OS_E_RESOURCE);
+    }
+}
+
+#endif /* (OS_RESOURCE_COUNT > 0U) */
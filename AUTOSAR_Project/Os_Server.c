@@ -0,0 +1,244 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Server.c
+ *
+ * Description: Source file for the aperiodic server of the Os Scheduler, a
+ *              sporadic server: the event task Os_ServerTask runs the queued
+ *              jobs as long as it has budget, and the budget consumed by a run
+ *              is given back one replenishment period after the run started.
+ *              The server never uses more than its budget in any window of one
+ *              period, so for the periodic tasks it is a periodic task with
+ *              that budget as execution time and their guarantees hold.
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#include "Os_Server.h"
+#include "Os_Kernel.h"
+#include "Gpt.h"
+
+#if (OS_APERIODIC_SERVER == STD_ON)
+
+/* Replenishments waiting for their tick, one per run of the server in the last period */
+#define OS_SERVER_REPLENISHMENTS   (8U)
+
+/* Description: Structure to hold one queued job */
+typedef struct
+{
+    Os_ServerJobType Job;
+    uint32 Argument;
+    /* Timestamp of the submission */
+    uint32 Submitted;
+} Os_ServerJobEntryType;
+
+/* Description: Structure to hold a part of the budget given back on a tick */
+typedef struct
+{
+    uint32 Tick;
+    uint32 Amount;
+} Os_ServerReplenishmentType;
+
+/* Queued jobs, g_Server_Job_Count of them from g_Server_Job_Head */
+static Os_ServerJobEntryType g_Server_Jobs[OS_SERVER_JOB_COUNT];
+static uint16 g_Server_Job_Head = 0;
+static uint16 g_Server_Job_Count = 0;
+
+/* Full budget in timestamp cycles */
+static uint32 g_Server_Budget_Cycles = 0;
+
+/* Budget left in timestamp cycles, negative after a job ran past the end of the budget */
+static sint32 g_Server_Budget = 0;
+
+/* The budget ran out with jobs waiting, the tick activates the server once it is replenished */
+static boolean g_Server_Exhausted = FALSE;
+
+/* Pending replenishments in tick order, g_Server_Replenishment_Count of them from the head */
+static Os_ServerReplenishmentType g_Server_Replenishments[OS_SERVER_REPLENISHMENTS];
+static uint8 g_Server_Replenishment_Head = 0;
+static uint8 g_Server_Replenishment_Count = 0;
+
+/* Statistics, the response time is kept in cycles and converted when read */
+static Os_ServerStatusType g_Server_Status;
+static uint32 g_Server_Max_Response_Cycles = 0;
+
+static void Os_ServerAddReplenishment(uint32 Tick, uint32 Amount);
+
+/*********************************************************************************************/
+void Os_ServerInit(void)
+{
+    /* The timestamps run on the system clock like SysTick */
+    g_Server_Budget_Cycles = (uint32)(((uint64)OS_SERVER_BUDGET_US * SysTick_GetTickCycles())
+                                      / (OS_BASE_TIME * 1000U));
+    g_Server_Budget = (sint32)g_Server_Budget_Cycles;
+}
+
+/*********************************************************************************************/
+static void Os_ServerAddReplenishment(uint32 Tick, uint32 Amount)
+{
+    Os_ServerReplenishmentType * Replenishment;
+
+    if(g_Server_Replenishment_Count == OS_SERVER_REPLENISHMENTS)
+    {
+        /* Merged into the last one: that part of the budget comes back later, never earlier */
+        Replenishment = &g_Server_Replenishments[(g_Server_Replenishment_Head + OS_SERVER_REPLENISHMENTS - 1U)
+                                                 % OS_SERVER_REPLENISHMENTS];
+        Replenishment->Amount += Amount;
+    }
+    else
+    {
+        Replenishment = &g_Server_Replenishments[(g_Server_Replenishment_Head + g_Server_Replenishment_Count)
+                                                 % OS_SERVER_REPLENISHMENTS];
+        Replenishment->Amount = Amount;
+        g_Server_Replenishment_Count++;
+    }
+    Replenishment->Tick = Tick;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_ServerSubmit(Os_ServerJobType Job, uint32 Argument)
+{
+    Std_ReturnType Status = E_NOT_OK;
+    Os_ServerJobEntryType * Entry;
+    uint32 Primask;
+
+    if(Job == NULL_PTR)
+    {
+        return E_NOT_OK;
+    }
+
+    Primask = Os_CpuSaveAndDisable();
+    if(g_Server_Job_Count < OS_SERVER_JOB_COUNT)
+    {
+        Entry = &g_Server_Jobs[(g_Server_Job_Head + g_Server_Job_Count) % OS_SERVER_JOB_COUNT];
+        Entry->Job       = Job;
+        Entry->Argument  = Argument;
+        Entry->Submitted = Os_TimingGetTimestamp();
+        g_Server_Job_Count++;
+        if(!g_Server_Exhausted)
+        {
+            /* Already activated if the server is running or about to */
+            (void)Os_KernelActivateEvent(OsConf_OS_SERVERTASK_ID);
+        }
+        Status = E_OK;
+    }
+    else
+    {
+        g_Server_Status.LostJobs++;
+    }
+    Os_CpuRestore(Primask);
+    return Status;
+}
+
+/*********************************************************************************************/
+void Os_ServerTask(void)
+{
+    Os_ServerJobEntryType Entry;
+    uint32 Start_Tick = Os_KernelGetTickCounter();
+    uint32 Consumed = 0;
+    uint32 Start;
+    uint32 Elapsed;
+    uint32 Response;
+    uint32 Primask;
+
+    for(;;)
+    {
+        Primask = Os_CpuSaveAndDisable();
+        if(g_Server_Job_Count == 0)
+        {
+            Os_CpuRestore(Primask);
+            break;
+        }
+        if(g_Server_Budget <= 0)
+        {
+            /* The remaining jobs wait for the tick that gives the budget back */
+            g_Server_Exhausted = TRUE;
+            g_Server_Status.Exhaustions++;
+            Os_CpuRestore(Primask);
+            break;
+        }
+        Entry = g_Server_Jobs[g_Server_Job_Head];
+        g_Server_Job_Head = (uint16)((g_Server_Job_Head + 1U) % OS_SERVER_JOB_COUNT);
+        g_Server_Job_Count--;
+        Os_CpuRestore(Primask);
+
+        /* A job is not interrupted when the budget runs out, the overrun is taken from the next budget.
+         * The time the server is preempted is charged to it as well, which only errs on the safe side. */
+        Start = Os_TimingGetTimestamp();
+        Entry.Job(Entry.Argument);
+        Elapsed = Os_TimingGetTimestamp() - Start;
+        Response = Os_TimingGetTimestamp() - Entry.Submitted;
+        Consumed += Elapsed;
+
+        Primask = Os_CpuSaveAndDisable();
+        g_Server_Budget -= (sint32)Elapsed;
+        g_Server_Status.Jobs++;
+        if(Response > g_Server_Max_Response_Cycles)
+        {
+            g_Server_Max_Response_Cycles = Response;
+        }
+        Os_CpuRestore(Primask);
+    }
+
+    if(Consumed != 0)
+    {
+        Primask = Os_CpuSaveAndDisable();
+        Os_ServerAddReplenishment(Start_Tick + OS_SERVER_PERIOD, Consumed);
+        Os_CpuRestore(Primask);
+    }
+}
+
+/*********************************************************************************************/
+void Os_ServerTick(uint32 TickCounter)
+{
+    Os_ServerReplenishmentType * Replenishment;
+    uint32 Primask = Os_CpuSaveAndDisable();
+
+    while((g_Server_Replenishment_Count != 0) &&
+          ((sint32)(TickCounter - g_Server_Replenishments[g_Server_Replenishment_Head].Tick) >= 0))
+    {
+        Replenishment = &g_Server_Replenishments[g_Server_Replenishment_Head];
+        g_Server_Budget += (sint32)Replenishment->Amount;
+        g_Server_Replenishment_Head = (uint8)((g_Server_Replenishment_Head + 1U) % OS_SERVER_REPLENISHMENTS);
+        g_Server_Replenishment_Count--;
+    }
+
+    if(g_Server_Exhausted && (g_Server_Budget > 0))
+    {
+        g_Server_Exhausted = FALSE;
+        (void)Os_KernelActivateEvent(OsConf_OS_SERVERTASK_ID);
+    }
+    Os_CpuRestore(Primask);
+}
+
+/*********************************************************************************************/
+uint32 Os_ServerGetIdleTicks(uint32 TickCounter)
+{
+    /* Only an exhausted server has to be woken up, the other replenishments can be counted late */
+    if(g_Server_Exhausted && (g_Server_Replenishment_Count != 0))
+    {
+        return g_Server_Replenishments[g_Server_Replenishment_Head].Tick - TickCounter;
+    }
+    return 0xFFFFFFFF;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_ServerGetStatus(Os_ServerStatusType * Status)
+{
+    uint32 Primask;
+
+    if(Status == NULL_PTR)
+    {
+        return E_NOT_OK;
+    }
+
+    Primask = Os_CpuSaveAndDisable();
+    *Status = g_Server_Status;
+    Status->MaxResponseUs = (uint32)(((uint64)g_Server_Max_Response_Cycles * (OS_BASE_TIME * 1000U))
+                                     / SysTick_GetTickCycles());
+    Os_CpuRestore(Primask);
+    return E_OK;
+}
+
+#endif /* (OS_APERIODIC_SERVER == STD_ON) */
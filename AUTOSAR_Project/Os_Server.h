@@ -0,0 +1,60 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Server.h
+ *
+ * Description: Header file for the aperiodic server of the Os Scheduler: short
+ *              event-triggered jobs run by the event task Os_ServerTask as soon
+ *              as they are submitted, within a budget per replenishment period.
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#ifndef OS_SERVER_H_
+#define OS_SERVER_H_
+
+#include "Os.h"
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for a job of the aperiodic server, it gets the Argument given to Os_ServerSubmit */
+typedef void (*Os_ServerJobType)(uint32 Argument);
+
+/* Description: Structure to hold the statistics of the aperiodic server */
+typedef struct
+{
+    /* Jobs run since the Os started */
+    uint32 Jobs;
+    /* Jobs that could not be submitted because the queue was full */
+    uint32 LostJobs;
+    /* Times the budget ran out with jobs still waiting for the next replenishment */
+    uint32 Exhaustions;
+    /* Longest time from the submission to the end of a job, in microseconds */
+    uint32 MaxResponseUs;
+} Os_ServerStatusType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+#if (OS_APERIODIC_SERVER == STD_ON)
+
+/*
+ * Description: Queue a job for the aperiodic server, it runs when the server has budget and its
+ *              priority allows. Returns E_NOT_OK for a NULL_PTR job or when the queue is full.
+ *              Callable from tasks and ISRs.
+ */
+Std_ReturnType Os_ServerSubmit(Os_ServerJobType Job, uint32 Argument);
+
+/* Description: Get the statistics of the aperiodic server. Returns E_NOT_OK for a NULL_PTR */
+Std_ReturnType Os_ServerGetStatus(Os_ServerStatusType * Status);
+
+/* Description: Event task generated with OS_APERIODIC_SERVER, runs the submitted jobs */
+void Os_ServerTask(void);
+
+#endif
+
+#endif /* OS_SERVER_H_ */
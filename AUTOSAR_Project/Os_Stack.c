@@ -0,0 +1,116 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Stack.c
+ *
+ * Description: Source file for the stack monitoring of the Os Scheduler. The
+ *              unused stack is painted with OS_STACK_PAINT_PATTERN (the main
+ *              stack by ResetISR, the task stacks by Os_KernelStart), the
+ *              high-water mark is the deepest word no longer holding it and
+ *              the lowest words are checked on every tick as a canary.
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#include "Os_Kernel.h"
+#include "Det.h"
+
+#if (OS_STACK_MONITORING == STD_ON)
+
+/* Number of words at the bottom of every stack that must never be used */
+#define OS_STACK_CANARY_WORDS      (4U)
+
+/* Bottom of the main stack (.stack section) and its size (--stack_size), defined by the linker:
+ * the value of __STACK_SIZE is its address */
+extern uint32 __stack;
+extern uint32 __STACK_SIZE;
+#define OS_MAIN_STACK_SIZE         ((uint32)&__STACK_SIZE)
+
+static uint32 Os_StackHighWater(const uint32 * Stack, uint32 Size);
+static boolean Os_StackCanaryIntact(const uint32 * Stack);
+
+/*********************************************************************************************/
+void Os_StackPaint(uint32 * Stack, uint32 Size)
+{
+    uint32 Index;
+
+    for(Index = 0; Index < (Size / 4U); Index++)
+    {
+        Stack[Index] = OS_STACK_PAINT_PATTERN;
+    }
+}
+
+/*********************************************************************************************/
+static uint32 Os_StackHighWater(const uint32 * Stack, uint32 Size)
+{
+    uint32 Index = 0;
+
+    /* The stacks grow down: the first modified word from the bottom is the deepest use */
+    while((Index < (Size / 4U)) && (Stack[Index] == OS_STACK_PAINT_PATTERN))
+    {
+        Index++;
+    }
+    return Size - (Index * 4U);
+}
+
+/*********************************************************************************************/
+static boolean Os_StackCanaryIntact(const uint32 * Stack)
+{
+    uint8 Index;
+
+    for(Index = 0; Index < OS_STACK_CANARY_WORDS; Index++)
+    {
+        if(Stack[Index] != OS_STACK_PAINT_PATTERN)
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/*********************************************************************************************/
+void Os_StackCheck(void)
+{
+    boolean Intact = Os_StackCanaryIntact(&__stack);
+#if (OS_SCHEDULING_MODE == OS_SCHEDULING_PREEMPTIVE)
+    Os_TaskType TaskId;
+
+    Intact = (boolean)(Intact && Os_StackCanaryIntact(Os_IdleStack));
+    for(TaskId = 0; TaskId < OS_TASK_COUNT; TaskId++)
+    {
+        Intact = (boolean)(Intact && Os_StackCanaryIntact(Os_Configuration.Tasks[TaskId].Stack));
+    }
+#endif
+
+    if(!Intact)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_NEW_TIMER_TICK_SID, OS_E_STACK_FAULT);
+    }
+}
+
+/*********************************************************************************************/
+uint32 Os_GetStackUsage(void)
+{
+    return Os_StackHighWater(&__stack, OS_MAIN_STACK_SIZE);
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_GetTaskStackUsage(Os_TaskType TaskId, uint32 * Usage)
+{
+#if (OS_SCHEDULING_MODE == OS_SCHEDULING_PREEMPTIVE)
+    if((TaskId >= OS_TASK_COUNT) || (Usage == NULL_PTR))
+    {
+        return E_NOT_OK;
+    }
+    *Usage = Os_StackHighWater(Os_Configuration.Tasks[TaskId].Stack, Os_Configuration.Tasks[TaskId].StackSize);
+    return E_OK;
+#else
+    /* The tasks share the main stack, see Os_GetStackUsage */
+    (void)TaskId;
+    (void)Usage;
+    return E_NOT_OK;
+#endif
+}
+
+#endif /* (OS_STACK_MONITORING == STD_ON) */
@@ -0,0 +1,254 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Timing.c
+ *
+ * Description: Source file for the timestamps and the task execution time
+ *              measurement of the Os Scheduler. Every task run is timestamped
+ *              with the DWT cycle counter (or the SysTick counter when the DWT
+ *              is not present) and kept as min/max/mean and a log-scale
+ *              histogram per task.
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#include "Os_Kernel.h"
+#include "Gpt.h"
+#include "tm4c123gh6pm_registers.h"
+
+#if (OS_TIMESTAMPS == STD_ON)
+
+/* Core Debug DEMCR: enable the DWT and ITM units */
+#define OS_DEMCR_TRCENA_MASK       0x01000000
+
+/* DWT_CTRL: cycle counter enable and cycle counter not implemented bits */
+#define OS_DWT_CYCCNTENA_MASK      0x00000001
+#define OS_DWT_NOCYCCNT_MASK       0x02000000
+
+/* ITM_TCR enable bit and ITM_TER bit of the stimulus port 0 */
+#define OS_ITM_TCR_ITMENA_MASK     0x00000001
+#define OS_ITM_TER_PORT0_MASK      0x00000001
+
+/* The DWT cycle counter is optional on Cortex-M4 */
+static boolean g_Cycle_Counter_Present = FALSE;
+
+/*********************************************************************************************/
+void Os_TimingInit(void)
+{
+    CORE_DEBUG_DEMCR_REG |= OS_DEMCR_TRCENA_MASK;
+
+    if((DWT_CTRL_REG & OS_DWT_NOCYCCNT_MASK) == 0)
+    {
+        DWT_CYCCNT_REG = 0;
+        DWT_CTRL_REG  |= OS_DWT_CYCCNTENA_MASK;
+        g_Cycle_Counter_Present = TRUE;
+    }
+
+#if (OS_EXECUTION_TIME_MEASUREMENT == STD_ON)
+    Os_ResetExecutionTimes();
+#endif
+}
+
+/*********************************************************************************************/
+uint32 Os_TimingGetTimestamp(void)
+{
+    if(g_Cycle_Counter_Present)
+    {
+        return DWT_CYCCNT_REG;
+    }
+
+    /* Fallback: cycles of the counted ticks plus the cycles elapsed in the current tick,
+     * the wrap-around of the 32-bit result is harmless as only differences are used */
+    return (Os_KernelGetTickCounter() * SysTick_GetTickCycles()) + SysTick_GetElapsedCycles();
+}
+
+#endif
+
+#if (OS_EXECUTION_TIME_MEASUREMENT == STD_ON)
+
+/* First bucket of the histograms covers 0 .. 2^8 - 1 cycles */
+#define OS_HISTOGRAM_FIRST_BIT     8U
+
+/* Measured execution times, Mean is only computed when the times are read */
+static Os_ExecutionTimeType g_Task_Execution_Time[OS_TASK_COUNT];
+
+/* Sum of the runs of every task to compute the mean */
+static uint64 g_Task_Total_Cycles[OS_TASK_COUNT];
+
+/* Execution time of the tasks that preempted the context being measured */
+static uint32 g_Preempted_Cycles = 0;
+
+static void Os_ItmPutString(const char * String);
+static void Os_ItmPutNumber(uint32 Number);
+
+/*********************************************************************************************/
+void Os_TimingStart(Os_TimingContextType * Context)
+{
+    uint32 Primask = Os_CpuSaveAndDisable();
+
+    Context->Preempted = g_Preempted_Cycles;
+    g_Preempted_Cycles = 0;
+    Context->Start     = Os_TimingGetTimestamp();
+    Os_CpuRestore(Primask);
+}
+
+/*********************************************************************************************/
+void Os_TimingStop(Os_TaskType TaskId, const Os_TimingContextType * Context)
+{
+    Os_ExecutionTimeType * Time = &g_Task_Execution_Time[TaskId];
+    uint32 Elapsed;
+    uint32 Cycles;
+    uint32 Bucket = 0;
+    uint32 Primask;
+
+    Primask = Os_CpuSaveAndDisable();
+    Elapsed = Os_TimingGetTimestamp() - Context->Start;
+
+    /* The tasks run to completion so the preemptions are nested: the runs of the tasks that
+     * preempted this one were added to g_Preempted_Cycles, this whole run is preemption time
+     * for the context this task preempted */
+    Cycles = Elapsed - g_Preempted_Cycles;
+    g_Preempted_Cycles = Context->Preempted + Elapsed;
+    Os_CpuRestore(Primask);
+
+    if(Cycles >= ((uint32)1 << OS_HISTOGRAM_FIRST_BIT))
+    {
+        Bucket = Os_CpuHighestBit(Cycles) - (OS_HISTOGRAM_FIRST_BIT - 1U);
+        if(Bucket >= OS_EXECUTION_TIME_BUCKETS)
+        {
+            Bucket = OS_EXECUTION_TIME_BUCKETS - 1U;
+        }
+    }
+
+    /* Only the task itself updates its statistics and a task does not preempt itself */
+    if(Cycles < Time->Min)
+    {
+        Time->Min = Cycles;
+    }
+    if(Cycles > Time->Max)
+    {
+        Time->Max = Cycles;
+    }
+    Time->Count++;
+    Time->Histogram[Bucket]++;
+    g_Task_Total_Cycles[TaskId] += Cycles;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_GetTaskExecutionTime(Os_TaskType TaskId, Os_ExecutionTimeType * ExecutionTime)
+{
+    uint32 Primask;
+
+    if((TaskId >= OS_TASK_COUNT) || (ExecutionTime == NULL_PTR))
+    {
+        return E_NOT_OK;
+    }
+
+    /* Copy with interrupts disabled so the statistics of one run are consistent */
+    Primask = Os_CpuSaveAndDisable();
+    *ExecutionTime = g_Task_Execution_Time[TaskId];
+    ExecutionTime->Mean = 0;
+    if(ExecutionTime->Count > 0)
+    {
+        ExecutionTime->Mean = (uint32)(g_Task_Total_Cycles[TaskId] / ExecutionTime->Count);
+    }
+    else
+    {
+        ExecutionTime->Min = 0;
+    }
+    Os_CpuRestore(Primask);
+    return E_OK;
+}
+
+/*********************************************************************************************/
+void Os_ResetExecutionTimes(void)
+{
+    Os_TaskType TaskId;
+    uint8 Bucket;
+    uint32 Primask;
+
+    Primask = Os_CpuSaveAndDisable();
+    for(TaskId = 0; TaskId < OS_TASK_COUNT; TaskId++)
+    {
+        g_Task_Execution_Time[TaskId].Count = 0;
+        g_Task_Execution_Time[TaskId].Min   = 0xFFFFFFFF;
+        g_Task_Execution_Time[TaskId].Max   = 0;
+        g_Task_Execution_Time[TaskId].Mean  = 0;
+        for(Bucket = 0; Bucket < OS_EXECUTION_TIME_BUCKETS; Bucket++)
+        {
+            g_Task_Execution_Time[TaskId].Histogram[Bucket] = 0;
+        }
+        g_Task_Total_Cycles[TaskId] = 0;
+    }
+    Os_CpuRestore(Primask);
+}
+
+/*********************************************************************************************/
+void Os_DumpExecutionTimes(void)
+{
+    Os_ExecutionTimeType Time;
+    Os_TaskType TaskId;
+    uint8 Bucket;
+
+    if(((ITM_TCR_REG & OS_ITM_TCR_ITMENA_MASK) == 0) || ((ITM_TER_REG & OS_ITM_TER_PORT0_MASK) == 0))
+    {
+        /* No debugger listening on the SWO channel */
+        return;
+    }
+
+    /* One line per task: Os task <id>: n=<count> min=<cycles> mean=<cycles> max=<cycles> hist=<bucket counts> */
+    for(TaskId = 0; TaskId < OS_TASK_COUNT; TaskId++)
+    {
+        (void)Os_GetTaskExecutionTime(TaskId, &Time);
+        Os_ItmPutString("Os task ");
+        Os_ItmPutNumber(TaskId);
+        Os_ItmPutString(": n=");
+        Os_ItmPutNumber(Time.Count);
+        Os_ItmPutString(" min=");
+        Os_ItmPutNumber(Time.Min);
+        Os_ItmPutString(" mean=");
+        Os_ItmPutNumber(Time.Mean);
+        Os_ItmPutString(" max=");
+        Os_ItmPutNumber(Time.Max);
+        Os_ItmPutString(" hist=");
+        for(Bucket = 0; Bucket < OS_EXECUTION_TIME_BUCKETS; Bucket++)
+        {
+            Os_ItmPutNumber(Time.Histogram[Bucket]);
+            Os_ItmPutString((Bucket == (OS_EXECUTION_TIME_BUCKETS - 1U)) ? "\r\n" : ",");
+        }
+    }
+}
+
+/*********************************************************************************************/
+static void Os_ItmPutString(const char * String)
+{
+    while(*String != '\0')
+    {
+        /* The stimulus port reads 1 when its FIFO can take a new character */
+        while(ITM_STIM0_REG == 0)
+        {
+        }
+        *((volatile uint8 *)&ITM_STIM0_REG) = (uint8)*String;
+        String++;
+    }
+}
+
+/*********************************************************************************************/
+static void Os_ItmPutNumber(uint32 Number)
+{
+    char Digits[11];
+    uint8 Index = 10;
+
+    Digits[10] = '\0';
+    do
+    {
+        Index--;
+        Digits[Index] = (char)('0' + (Number % 10));
+        Number /= 10;
+    } while(Number != 0);
+
+    Os_ItmPutString(&Digits[Index]);
+}
+
+#endif /* (OS_EXECUTION_TIME_MEASUREMENT == STD_ON) */
@@ -0,0 +1,58 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Trace.c
+ *
+ * Description: Source file for the trace recorder of the Os Scheduler. Every
+ *              record is written with interrupts disabled for a few cycles, so
+ *              the records of nested contexts stay in time order. Os_TraceRecorder
+ *              is found in Debug/AUTOSAR_Project.map to dump it.
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#include "Os_Trace.h"
+#include "Os_Kernel.h"
+#include "Gpt.h"
+
+#if (OS_TRACE == STD_ON)
+
+#if ((OS_TRACE_RECORD_COUNT & (OS_TRACE_RECORD_COUNT - 1U)) != 0) || (OS_TRACE_RECORD_COUNT > 0x8000U)
+#error "Os: OS_TRACE_RECORD_COUNT must be a power of 2 up to 32768"
+#endif
+
+/* Recorder dumped by the debugger, the header is completed by Os_TraceInit */
+Os_TraceRecorderType Os_TraceRecorder;
+
+/*********************************************************************************************/
+void Os_TraceInit(void)
+{
+    /* The tick period is OS_BASE_TIME ms of timestamp cycles, with or without the DWT counter */
+    Os_TraceRecorder.ClockHz  = (SysTick_GetTickCycles() * 1000U) / OS_BASE_TIME;
+    Os_TraceRecorder.Capacity = OS_TRACE_RECORD_COUNT;
+    Os_TraceRecorder.Version  = OS_TRACE_VERSION;
+    Os_TraceRecorder.Magic    = OS_TRACE_MAGIC;
+}
+
+/*********************************************************************************************/
+void Os_TraceRecord(uint8 Event, uint8 Id, uint16 Data)
+{
+    uint32 Primask = Os_CpuSaveAndDisable();
+    Os_TraceRecordType * Record = &Os_TraceRecorder.Records[Os_TraceRecorder.Written & (OS_TRACE_RECORD_COUNT - 1U)];
+
+    Record->Timestamp = Os_TimingGetTimestamp();
+    Record->Event     = Event;
+    Record->Id        = Id;
+    Record->Data      = Data;
+    Os_TraceRecorder.Written++;
+    Os_CpuRestore(Primask);
+}
+
+/*********************************************************************************************/
+void Os_TraceMarker(uint8 Id, uint16 Value)
+{
+    Os_TraceRecord(OS_TRACE_EVENT_MARKER, Id, Value);
+}
+
+#endif /* (OS_TRACE == STD_ON) */
@@ -0,0 +1,101 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Trace.h
+ *
+ * Description: Header file for the trace recorder of the Os Scheduler: task
+ *              start/end, ISR entry/exit and user markers are written as
+ *              timestamped binary records into a RAM ring buffer. The buffer
+ *              is dumped with the debugger and decoded on the host by
+ *              Tools/Os_TraceDecode.py.
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#ifndef OS_TRACE_H_
+#define OS_TRACE_H_
+
+#include "Os.h"
+
+/* Identification of the recorder in a memory dump: "OSTR" in little-endian */
+#define OS_TRACE_MAGIC                 (0x5254534FUL)
+
+/* Version of the record layout, to be increased when Tools/Os_TraceDecode.py has to change */
+#define OS_TRACE_VERSION               (1U)
+
+/* Record events, the meaning of Id and Data depends on the event */
+#define OS_TRACE_EVENT_TASK_START      (1U)   /* Id: task, Data: 0 */
+#define OS_TRACE_EVENT_TASK_END        (2U)   /* Id: task, Data: 0 */
+#define OS_TRACE_EVENT_ISR_ENTER       (3U)   /* Id: OS_TRACE_ISR_xxx, Data: 0 */
+#define OS_TRACE_EVENT_ISR_EXIT        (4U)   /* Id: OS_TRACE_ISR_xxx, Data: 0 */
+#define OS_TRACE_EVENT_MARKER          (5U)   /* Id: marker, Data: value given by the application */
+
+/* ISRs traced by the drivers */
+#define OS_TRACE_ISR_SYSTICK           (0U)
+#define OS_TRACE_ISR_GPT               (1U)   /* Timeout of a Gpt channel */
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Description: Structure of one trace record, 8 bytes */
+typedef struct
+{
+    /* Clock cycles from the Os timestamp counter, wraps around every 2^32 cycles */
+    uint32 Timestamp;
+    /* OS_TRACE_EVENT_xxx */
+    uint8 Event;
+    uint8 Id;
+    uint16 Data;
+} Os_TraceRecordType;
+
+/*
+ * Description: Structure of the recorder, one block of RAM to dump: a header describing the
+ *              buffer followed by the ring buffer itself.
+ */
+typedef struct
+{
+    /* OS_TRACE_MAGIC and OS_TRACE_VERSION, set by Os_start */
+    uint32 Magic;
+    uint16 Version;
+    /* Number of records of the ring buffer (OS_TRACE_RECORD_COUNT) */
+    uint16 Capacity;
+    /* Frequency of the timestamp counter in Hz */
+    uint32 ClockHz;
+    /* Number of records written since the start, the next one goes to Written % Capacity */
+    uint32 Written;
+    Os_TraceRecordType Records[OS_TRACE_RECORD_COUNT];
+} Os_TraceRecorderType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+#if (OS_TRACE == STD_ON)
+
+/*
+ * Description: Write one record with the current timestamp. The oldest record is overwritten
+ *              when the buffer is full. Callable from tasks, ISRs and with interrupts disabled.
+ */
+void Os_TraceRecord(uint8 Event, uint8 Id, uint16 Data);
+
+/* Description: Record a user marker with a value, shown as an instant event by the decoder */
+void Os_TraceMarker(uint8 Id, uint16 Value);
+
+/* Trace points of the Os and of the drivers, they disappear when OS_TRACE is STD_OFF */
+#define OS_TRACE_TASK_START(TaskId)    Os_TraceRecord(OS_TRACE_EVENT_TASK_START, (TaskId), 0U)
+#define OS_TRACE_TASK_END(TaskId)      Os_TraceRecord(OS_TRACE_EVENT_TASK_END, (TaskId), 0U)
+#define OS_TRACE_ISR_ENTER(Isr)        Os_TraceRecord(OS_TRACE_EVENT_ISR_ENTER, (Isr), 0U)
+#define OS_TRACE_ISR_EXIT(Isr)         Os_TraceRecord(OS_TRACE_EVENT_ISR_EXIT, (Isr), 0U)
+
+#else
+
+#define OS_TRACE_TASK_START(TaskId)
+#define OS_TRACE_TASK_END(TaskId)
+#define OS_TRACE_ISR_ENTER(Isr)
+#define OS_TRACE_ISR_EXIT(Isr)
+
+#endif
+
+#endif /* OS_TRACE_H_ */
@@ -22,6 +22,7 @@
 #endif
 
 #include "Port_Regs.h"
+#include "SchM.h"
 
 /*====================================================================
                        Global Variables
@@ -91,17 +92,21 @@ void Port_Init(const Port_ConfigType* ConfigPtr){
                 }
 
                 /* Enable Clock of the Port */
+                SchM_Enter_Port_PORT_EXCLUSIVE_AREA_0();
                 SYSCTL_RCGCGPIO_REG |= (1<<Port_PortPins[index].port_num);
+                SchM_Exit_Port_PORT_EXCLUSIVE_AREA_0();
                 while(!(SYSCTL_PRGPIO_REG & Port_PortPins[index].port_num ));
 
 
                 if( (Port_PortPins[index].port_num==PORTF && Port_PortPins[index].pin_num==PIN0)\
                   ||(Port_PortPins[index].port_num==PORTD && Port_PortPins[index].pin_num==PIN7)){
+                    SchM_Enter_Port_PORT_EXCLUSIVE_AREA_0();
                     /* Unlock the GPIOCR register */
                     *((volatile uint32 *)(Port_base+PORT_LOCK_REG_OFFSET))    = 0x4C4F434B;
                     /* Clear then Set the corresponding bit in GPIOCR register to allow changes on this pin */
                     *((volatile uint32 *)(Port_base+PORT_COMMIT_REG_OFFSET)) &=  ~(1<<Port_PortPins[index].pin_num);
                     *((volatile uint32 *)(Port_base+PORT_COMMIT_REG_OFFSET)) |=  (1<<Port_PortPins[index].pin_num);
+                    SchM_Exit_Port_PORT_EXCLUSIVE_AREA_0();
                 }
                 else if((Port_PortPins[index].port_num == PORTC) && (Port_PortPins[index].pin_num <= PIN3 )){
                     /* JTAG PINS FOR DEBUGGING ONLY */
@@ -111,6 +116,9 @@ void Port_Init(const Port_ConfigType* ConfigPtr){
                     /* Do Nothing ... No need to unlock the commit register for this pin */
                 }
 
+                /* The registers are shared with the other pins of the port */
+                SchM_Enter_Port_PORT_EXCLUSIVE_AREA_0();
+
                 /* Check if Mode PORT_DIO_MODE */
                 if(Port_PortPins[index].pin_mode==PORT_DIO_MODE){
                     /* Set Corresponding pin in Enable register */
@@ -193,6 +201,7 @@ void Port_Init(const Port_ConfigType* ConfigPtr){
                 else{
                     /* Do nothing */
                 }
+                SchM_Exit_Port_PORT_EXCLUSIVE_AREA_0();
 
             }
             /* Set the Module State to initialized*/
@@ -281,6 +290,7 @@ void Port_SetPinDirection( Port_PinType Pin, Port_PinDirectionType Direction ){
                /* Do nothing */
            }
 
+           SchM_Enter_Port_PORT_EXCLUSIVE_AREA_0();
            /* Check if the direction is input */
            if(Direction==PORT_PIN_IN){
                /* Clear Corresponding pin in DIR register */
@@ -294,6 +304,7 @@ void Port_SetPinDirection( Port_PinType Pin, Port_PinDirectionType Direction ){
            else{
                /* Do nothing */
            }
+           SchM_Exit_Port_PORT_EXCLUSIVE_AREA_0();
 
        }
        else{
@@ -361,6 +372,7 @@ void Port_RefreshPortDirection( void ){
                    else{
                        /* Do nothing */
                    }
+                   SchM_Enter_Port_PORT_EXCLUSIVE_AREA_0();
                    /* Check if the direction is output */
                    if(Port_PortPins[index].pin_direction==PORT_PIN_OUT){
                        /* Clear Corresponding pin in DIR register */
@@ -376,6 +388,7 @@ void Port_RefreshPortDirection( void ){
                    else{
                        /* Do nothing */
                    }
+                   SchM_Exit_Port_PORT_EXCLUSIVE_AREA_0();
 
                }
            }
@@ -516,6 +529,9 @@ void Port_SetPinMode( Port_PinType Pin, Port_PinModeType Mode ){
             /* Do nothing */
         }
 
+        /* The registers are shared with the other pins of the port */
+        SchM_Enter_Port_PORT_EXCLUSIVE_AREA_0();
+
         /* Check if Mode PORT_DIO_MODE */
         if(Port_PortPins[Pin].pin_mode==PORT_DIO_MODE){
             /* Set Corresponding pin in Enable register */
@@ -560,6 +576,7 @@ void Port_SetPinMode( Port_PinType Pin, Port_PinModeType Mode ){
             /* Set mode in the Corresponding pins in PCTL register */
             *((volatile uint32 *)(Port_base+PORT_CTL_REG_OFFSET)) |= (Port_PortPins[Pin].pin_mode<<Port_PortPins[Pin].pin_num*4);
         }
+        SchM_Exit_Port_PORT_EXCLUSIVE_AREA_0();
     }
     else{
         /* Do nothing */
@@ -0,0 +1,216 @@
+ /******************************************************************************
+ *
+ * Module: SchM
+ *
+ * File Name: SchM.c
+ *
+ * Description: Source file for the exclusive areas of the Basic Software
+ *              Scheduler. The outermost Enter raises BASEPRI to
+ *              SCHM_BASEPRI_LEVEL and the matching Exit restores it, so the
+ *              interrupts above the level are never delayed by a driver.
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#include "SchM.h"
+#include "Os_Kernel.h"
+
+#if (SCHM_DEV_ERROR_DETECT == STD_ON)
+
+#include "Det.h"
+/* AUTOSAR Version checking between Det and SchM Modules */
+#if ((DET_AR_MAJOR_VERSION != SCHM_AR_RELEASE_MAJOR_VERSION)\
+ || (DET_AR_MINOR_VERSION != SCHM_AR_RELEASE_MINOR_VERSION)\
+ || (DET_AR_PATCH_VERSION != SCHM_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Det.h does not match the expected version"
+#endif
+
+#endif
+
+#if (SCHM_BASEPRI_LEVEL < 1U) || (SCHM_BASEPRI_LEVEL > 7U)
+#error "SchM: SCHM_BASEPRI_LEVEL must be 1 - 7, BASEPRI 0 does not mask anything"
+#endif
+
+#if (SCHM_LOCK_TIME_MEASUREMENT == STD_ON) && (OS_TIMESTAMPS == STD_OFF)
+#error "SchM: the lock time measurement needs the Os timestamps"
+#endif
+
+/* BASEPRI value of the level, the priority is in the 3 implemented upper bits of the byte */
+#define SCHM_BASEPRI_VALUE         ((uint32)SCHM_BASEPRI_LEVEL << 5)
+
+/* Number of exclusive areas currently entered, of any area and by any context. A context
+ * preempting from above the level always leaves its areas before it returns. */
+STATIC uint32 SchM_Nesting = 0;
+
+/* BASEPRI before the outermost Enter, restored by the last Exit */
+STATIC uint32 SchM_Saved_Basepri = 0;
+
+/* Nesting depth of every area, to find its outermost Enter and Exit */
+STATIC uint8 SchM_Area_Depth[SCHM_EXCLUSIVE_AREA_COUNT];
+
+#if (SCHM_LOCK_TIME_MEASUREMENT == STD_ON)
+/* Timestamp of the outermost Enter of every area */
+STATIC uint32 SchM_Area_Start[SCHM_EXCLUSIVE_AREA_COUNT];
+
+/* Measured lock times */
+STATIC SchM_LockTimeType SchM_Lock_Time[SCHM_EXCLUSIVE_AREA_COUNT];
+#endif
+
+/************************************************************************************
+* Service Name: SchM_Enter
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Area - ID of the exclusive area.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enter an exclusive area: mask the interrupts up to
+*              SCHM_BASEPRI_LEVEL until the matching SchM_Exit.
+************************************************************************************/
+void SchM_Enter(SchM_ExclusiveAreaType Area)
+{
+    uint32 Basepri;
+
+#if (SCHM_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the used area is within the valid range */
+    if (SCHM_EXCLUSIVE_AREA_COUNT <= Area)
+    {
+        Det_ReportError(SCHM_MODULE_ID, SCHM_INSTANCE_ID, SCHM_ENTER_SID, SCHM_E_PARAM_AREA);
+        return;
+    }
+#endif
+
+    /* A context preempting between the two steps enters and leaves on its own and
+     * restores the BASEPRI it found, so no step has to be atomic with the other */
+    Basepri = Os_CpuRaiseBasepri(SCHM_BASEPRI_VALUE);
+    if (SchM_Nesting == 0)
+    {
+        SchM_Saved_Basepri = Basepri;
+    }
+    SchM_Nesting++;
+
+    SchM_Area_Depth[Area]++;
+#if (SCHM_LOCK_TIME_MEASUREMENT == STD_ON)
+    if (SchM_Area_Depth[Area] == 1)
+    {
+        SchM_Area_Start[Area] = Os_TimingGetTimestamp();
+    }
+#endif
+}
+
+/************************************************************************************
+* Service Name: SchM_Exit
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Area - ID of the exclusive area.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to leave an exclusive area, the last Exit restores the
+*              interrupt masking found by the outermost Enter.
+************************************************************************************/
+void SchM_Exit(SchM_ExclusiveAreaType Area)
+{
+#if (SCHM_LOCK_TIME_MEASUREMENT == STD_ON)
+    uint32 Elapsed;
+#endif
+
+#if (SCHM_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the used area is within the valid range */
+    if (SCHM_EXCLUSIVE_AREA_COUNT <= Area)
+    {
+        Det_ReportError(SCHM_MODULE_ID, SCHM_INSTANCE_ID, SCHM_EXIT_SID, SCHM_E_PARAM_AREA);
+        return;
+    }
+    /* Check if the area was entered */
+    if (0 == SchM_Area_Depth[Area])
+    {
+        Det_ReportError(SCHM_MODULE_ID, SCHM_INSTANCE_ID, SCHM_EXIT_SID, SCHM_E_NOT_ENTERED);
+        return;
+    }
+#endif
+
+    SchM_Area_Depth[Area]--;
+#if (SCHM_LOCK_TIME_MEASUREMENT == STD_ON)
+    if (SchM_Area_Depth[Area] == 0)
+    {
+        Elapsed = Os_TimingGetTimestamp() - SchM_Area_Start[Area];
+        if (Elapsed > SchM_Lock_Time[Area].Max)
+        {
+            SchM_Lock_Time[Area].Max = Elapsed;
+        }
+        SchM_Lock_Time[Area].Count++;
+    }
+#endif
+
+    SchM_Nesting--;
+    if (SchM_Nesting == 0)
+    {
+        Os_CpuSetBasepri(SchM_Saved_Basepri);
+    }
+}
+
+#if (SCHM_LOCK_TIME_MEASUREMENT == STD_ON)
+/************************************************************************************
+* Service Name: SchM_GetLockTime
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Area - ID of the exclusive area.
+* Parameters (inout): None
+* Parameters (out): LockTime - Number of locks and longest lock time in clock cycles.
+* Return value: Std_ReturnType - E_NOT_OK for an invalid area or a NULL_PTR
+* Description: Function to get the lock times measured for an exclusive area.
+************************************************************************************/
+Std_ReturnType SchM_GetLockTime(SchM_ExclusiveAreaType Area, SchM_LockTimeType * LockTime)
+{
+    uint32 Primask;
+
+    if (SCHM_EXCLUSIVE_AREA_COUNT <= Area)
+    {
+#if (SCHM_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(SCHM_MODULE_ID, SCHM_INSTANCE_ID, SCHM_GET_LOCK_TIME_SID, SCHM_E_PARAM_AREA);
+#endif
+        return E_NOT_OK;
+    }
+    if (NULL_PTR == LockTime)
+    {
+#if (SCHM_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(SCHM_MODULE_ID, SCHM_INSTANCE_ID, SCHM_GET_LOCK_TIME_SID, SCHM_E_PARAM_POINTER);
+#endif
+        return E_NOT_OK;
+    }
+
+    /* The area may be left by a preempting context while it is copied */
+    Primask = Os_CpuSaveAndDisable();
+    *LockTime = SchM_Lock_Time[Area];
+    Os_CpuRestore(Primask);
+    return E_OK;
+}
+
+/************************************************************************************
+* Service Name: SchM_ResetLockTimes
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to clear the lock times measured for all the exclusive areas.
+************************************************************************************/
+void SchM_ResetLockTimes(void)
+{
+    uint32 Primask;
+    SchM_ExclusiveAreaType Area;
+
+    Primask = Os_CpuSaveAndDisable();
+    for (Area = 0; Area < SCHM_EXCLUSIVE_AREA_COUNT; Area++)
+    {
+        SchM_Lock_Time[Area].Count = 0;
+        SchM_Lock_Time[Area].Max   = 0;
+    }
+    Os_CpuRestore(Primask);
+}
+#endif
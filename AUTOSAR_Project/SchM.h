@@ -0,0 +1,132 @@
+ /******************************************************************************
+ *
+ * Module: SchM
+ *
+ * File Name: SchM.h
+ *
+ * Description: Header file for the exclusive areas of the Basic Software
+ *              Scheduler: nestable critical sections that only mask the
+ *              interrupts up to SCHM_BASEPRI_LEVEL through BASEPRI.
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#ifndef SCHM_H
+#define SCHM_H
+
+/* Id for the company in the AUTOSAR
+ * for example Mohannad Sabry's ID = 5000 :) */
+#define SCHM_VENDOR_ID    (5000U)
+
+/* SchM Module Id */
+#define SCHM_MODULE_ID    (130U)
+
+/* SchM Instance Id */
+#define SCHM_INSTANCE_ID  (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define SCHM_SW_MAJOR_VERSION           (1U)
+#define SCHM_SW_MINOR_VERSION           (0U)
+#define SCHM_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define SCHM_AR_RELEASE_MAJOR_VERSION   (4U)
+#define SCHM_AR_RELEASE_MINOR_VERSION   (0U)
+#define SCHM_AR_RELEASE_PATCH_VERSION   (3U)
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/* AUTOSAR checking between Std Types and SchM Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != SCHM_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != SCHM_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != SCHM_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* SchM Pre-Compile Configuration Header file */
+#include "SchM_Cfg.h"
+
+/* AUTOSAR Version checking between SchM_Cfg.h and SchM.h files */
+#if ((SCHM_CFG_AR_RELEASE_MAJOR_VERSION != SCHM_AR_RELEASE_MAJOR_VERSION)\
+ ||  (SCHM_CFG_AR_RELEASE_MINOR_VERSION != SCHM_AR_RELEASE_MINOR_VERSION)\
+ ||  (SCHM_CFG_AR_RELEASE_PATCH_VERSION != SCHM_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of SchM_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between SchM_Cfg.h and SchM.h files */
+#if ((SCHM_CFG_SW_MAJOR_VERSION != SCHM_SW_MAJOR_VERSION)\
+ ||  (SCHM_CFG_SW_MINOR_VERSION != SCHM_SW_MINOR_VERSION)\
+ ||  (SCHM_CFG_SW_PATCH_VERSION != SCHM_SW_PATCH_VERSION))
+  #error "The SW version of SchM_Cfg.h does not match the expected version"
+#endif
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for SchM Enter */
+#define SCHM_ENTER_SID                  (uint8)0x03
+
+/* Service ID for SchM Exit */
+#define SCHM_EXIT_SID                   (uint8)0x04
+
+/* Service ID for SchM Get Lock Time */
+#define SCHM_GET_LOCK_TIME_SID          (uint8)0x05
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* DET code to report an invalid exclusive area */
+#define SCHM_E_PARAM_AREA               (uint8)0x01
+
+/* DET code to report an exit of an exclusive area that was not entered */
+#define SCHM_E_NOT_ENTERED              (uint8)0x02
+
+/* DET code to report a NULL_PTR parameter */
+#define SCHM_E_PARAM_POINTER            (uint8)0x03
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for the exclusive area Id */
+typedef uint8 SchM_ExclusiveAreaType;
+
+/* Description: Structure to hold the lock times measured for one exclusive area */
+typedef struct
+{
+    /* Number of times the area was entered (outermost Enter only) */
+    uint32 Count;
+    /* Longest time in clock cycles between the outermost Enter and its Exit */
+    uint32 Max;
+} SchM_LockTimeType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/*
+ * Description: Enter an exclusive area: the interrupts up to SCHM_BASEPRI_LEVEL are held off
+ *              until the matching SchM_Exit. Areas can be nested, also with other areas.
+ */
+void SchM_Enter(SchM_ExclusiveAreaType Area);
+
+/* Description: Leave an exclusive area, the interrupt masking of the outermost Enter is restored */
+void SchM_Exit(SchM_ExclusiveAreaType Area);
+
+#if (SCHM_LOCK_TIME_MEASUREMENT == STD_ON)
+/*
+ * Description: Get the lock times measured for an exclusive area. Returns E_NOT_OK for an
+ *              invalid area or a NULL_PTR.
+ */
+Std_ReturnType SchM_GetLockTime(SchM_ExclusiveAreaType Area, SchM_LockTimeType * LockTime);
+
+/* Description: Clear the lock times measured for all the exclusive areas */
+void SchM_ResetLockTimes(void);
+#endif
+
+#endif /* SCHM_H */
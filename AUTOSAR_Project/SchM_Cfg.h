@@ -0,0 +1,60 @@
+ /******************************************************************************
+ *
+ * Module: SchM
+ *
+ * File Name: SchM_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for the exclusive areas
+ *              of the Basic Software Scheduler.
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#ifndef SCHM_CFG_H
+#define SCHM_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define SCHM_CFG_SW_MAJOR_VERSION              (1U)
+#define SCHM_CFG_SW_MINOR_VERSION              (0U)
+#define SCHM_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define SCHM_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define SCHM_CFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define SCHM_CFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* Pre-compile option for Development Error Detect */
+#define SCHM_DEV_ERROR_DETECT                (STD_ON)
+
+/* Pre-compile option for the measurement of the longest lock time of every exclusive area,
+ * it uses the Os timestamps (one of the Os measurements or the trace must be enabled) */
+#define SCHM_LOCK_TIME_MEASUREMENT           (STD_ON)
+
+/*
+ * NVIC priority level masked by the exclusive areas (1 - 7): the interrupts of this level and
+ * below (values 3 - 7: SysTick and the NVIC mode tasks) are held off, the ones above (0 - 2)
+ * keep running. An area must not be used by an ISR above this level.
+ */
+#define SCHM_BASEPRI_LEVEL                   (3U)
+
+/* Number of the configured exclusive areas */
+#define SCHM_EXCLUSIVE_AREA_COUNT            (3U)
+
+/* Exclusive area Ids */
+#define SCHM_DIO_EXCLUSIVE_AREA_0            (SchM_ExclusiveAreaType)0   /* Dio: read-modify-write of the GPIO DATA registers */
+#define SCHM_PORT_EXCLUSIVE_AREA_0           (SchM_ExclusiveAreaType)1   /* Port: read-modify-write of the GPIO configuration registers */
+#define SCHM_GPT_EXCLUSIVE_AREA_0            (SchM_ExclusiveAreaType)2   /* Gpt: channel state and the timer registers shared by the halves */
+
+/* Enter / Exit services of the exclusive areas used by the modules */
+#define SchM_Enter_Dio_DIO_EXCLUSIVE_AREA_0()     SchM_Enter(SCHM_DIO_EXCLUSIVE_AREA_0)
+#define SchM_Exit_Dio_DIO_EXCLUSIVE_AREA_0()      SchM_Exit(SCHM_DIO_EXCLUSIVE_AREA_0)
+#define SchM_Enter_Port_PORT_EXCLUSIVE_AREA_0()   SchM_Enter(SCHM_PORT_EXCLUSIVE_AREA_0)
+#define SchM_Exit_Port_PORT_EXCLUSIVE_AREA_0()    SchM_Exit(SCHM_PORT_EXCLUSIVE_AREA_0)
+#define SchM_Enter_Gpt_GPT_EXCLUSIVE_AREA_0()     SchM_Enter(SCHM_GPT_EXCLUSIVE_AREA_0)
+#define SchM_Exit_Gpt_GPT_EXCLUSIVE_AREA_0()      SchM_Exit(SCHM_GPT_EXCLUSIVE_AREA_0)
+
+#endif /* SCHM_CFG_H */
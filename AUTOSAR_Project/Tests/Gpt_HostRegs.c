@@ -0,0 +1,20 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Gpt_HostRegs.c
+ *
+ * Description: Simulated register blocks of the Gpt Driver for the host tests,
+ *              see Gpt_HostRegs.h. Zero at the start like after a reset, the
+ *              tests set the bits the hardware would set.
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#include "Gpt_HostRegs.h"
+
+/* Timers then wide timers, in Gpt_HwTimerType order */
+uint32 Gpt_Host_Timer[12][GPT_HOST_BLOCK_WORDS];
+uint32 Gpt_Host_Sysctl[GPT_HOST_BLOCK_WORDS];
+uint32 Gpt_Host_SysTick[GPT_HOST_BLOCK_WORDS];
+uint32 Gpt_Host_Scb[GPT_HOST_BLOCK_WORDS];
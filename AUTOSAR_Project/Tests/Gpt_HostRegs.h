@@ -0,0 +1,45 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Gpt_HostRegs.h
+ *
+ * Description: Simulated register blocks of the Gpt Driver for the host tests:
+ *              the timers, the System Control clock gating, the SysTick and
+ *              the Interrupt Control and State register. Included before
+ *              Gpt.c by the build so Gpt_Regs.h takes these base addresses
+ *              instead of the peripheral ones.
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#ifndef GPT_HOSTREGS_H
+#define GPT_HOSTREGS_H
+
+#include "Std_Types.h"
+
+/* Words of one simulated register block, covers the timer and System Control registers used */
+#define GPT_HOST_BLOCK_WORDS              (0x1000U / 4U)
+
+extern uint32 Gpt_Host_Timer[12][GPT_HOST_BLOCK_WORDS];
+extern uint32 Gpt_Host_Sysctl[GPT_HOST_BLOCK_WORDS];
+extern uint32 Gpt_Host_SysTick[GPT_HOST_BLOCK_WORDS];
+extern uint32 Gpt_Host_Scb[GPT_HOST_BLOCK_WORDS];
+
+#define GPT_TIMER0_BASE_ADDRESS           ((volatile uint8 *)Gpt_Host_Timer[0])
+#define GPT_TIMER1_BASE_ADDRESS           ((volatile uint8 *)Gpt_Host_Timer[1])
+#define GPT_TIMER2_BASE_ADDRESS           ((volatile uint8 *)Gpt_Host_Timer[2])
+#define GPT_TIMER3_BASE_ADDRESS           ((volatile uint8 *)Gpt_Host_Timer[3])
+#define GPT_TIMER4_BASE_ADDRESS           ((volatile uint8 *)Gpt_Host_Timer[4])
+#define GPT_TIMER5_BASE_ADDRESS           ((volatile uint8 *)Gpt_Host_Timer[5])
+#define GPT_WTIMER0_BASE_ADDRESS          ((volatile uint8 *)Gpt_Host_Timer[6])
+#define GPT_WTIMER1_BASE_ADDRESS          ((volatile uint8 *)Gpt_Host_Timer[7])
+#define GPT_WTIMER2_BASE_ADDRESS          ((volatile uint8 *)Gpt_Host_Timer[8])
+#define GPT_WTIMER3_BASE_ADDRESS          ((volatile uint8 *)Gpt_Host_Timer[9])
+#define GPT_WTIMER4_BASE_ADDRESS          ((volatile uint8 *)Gpt_Host_Timer[10])
+#define GPT_WTIMER5_BASE_ADDRESS          ((volatile uint8 *)Gpt_Host_Timer[11])
+#define GPT_SYSCTL_BASE_ADDRESS           ((volatile uint8 *)Gpt_Host_Sysctl)
+#define GPT_SYSTICK_BASE_ADDRESS          ((volatile uint8 *)Gpt_Host_SysTick)
+#define GPT_SCB_BASE_ADDRESS              ((volatile uint8 *)Gpt_Host_Scb)
+
+#endif /* GPT_HOSTREGS_H */
@@ -0,0 +1,511 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Gpt_Test.c
+ *
+ * Description: Host test of the Gpt Driver. The timer and System Control
+ *              blocks are RAM arrays (Gpt_HostRegs.h), the test plays the
+ *              hardware: it sets the counters and timeout flags and calls the
+ *              ISRs Gpt_Init registered. Det, Irq, SchM, Mcu and the Os trace
+ *              are stubbed here.
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#include <string.h>
+#include "Test.h"
+#include "Gpt_HostRegs.h"
+#include "Gpt.h"
+#include "Gpt_Regs.h"
+#include "Irq.h"
+#include "SchM.h"
+#include "Mcu.h"
+#include "Det.h"
+#include "Os_Trace.h"
+
+/* Register of a simulated timer block */
+#define TEST_TIMER_REG(Timer, Offset)     (Gpt_Host_Timer[(Timer)][(Offset) / 4U])
+
+/* Timer B registers missing in Gpt_Regs.h */
+#define TEST_TBMR_REG_OFFSET              (GPT_TAMR_REG_OFFSET + GPT_TIMER_B_REG_STEP)
+#define TEST_TBPR_REG_OFFSET              (GPT_TAPR_REG_OFFSET + GPT_TIMER_B_REG_STEP)
+
+/* Vectors of the sub-timers used by the tests */
+#define TEST_TIMER0A_VECTOR               IRQ_VECTOR(19U)
+#define TEST_TIMER0B_VECTOR               IRQ_VECTOR(20U)
+#define TEST_TIMER1A_VECTOR               IRQ_VECTOR(21U)
+#define TEST_WTIMER0A_VECTOR              IRQ_VECTOR(94U)
+#define TEST_WTIMER1A_VECTOR              IRQ_VECTOR(96U)
+#define TEST_WTIMER1B_VECTOR              IRQ_VECTOR(97U)
+
+/* Last error reported to the Det stub */
+static uint32 Test_Det_Count = 0;
+static uint16 Test_Det_Module = 0;
+static uint8 Test_Det_Api = 0;
+static uint8 Test_Det_Error = 0;
+
+/* Vectors as set up through the Irq stub */
+static Irq_HandlerType Test_Irq_Handler[IRQ_VECTOR_COUNT];
+static Irq_PriorityType Test_Irq_Priority[IRQ_VECTOR_COUNT];
+static boolean Test_Irq_Enabled[IRQ_VECTOR_COUNT];
+
+static uint32 Test_Notifications = 0;
+
+/* Exactly one error reported since the last check */
+#define TEST_CHECK_DET(Api, Error) \
+    do { \
+        TEST_CHECK_EQUAL(Test_Det_Count, 1U); \
+        TEST_CHECK_EQUAL(Test_Det_Module, GPT_MODULE_ID); \
+        TEST_CHECK_EQUAL(Test_Det_Api, (Api)); \
+        TEST_CHECK_EQUAL(Test_Det_Error, (Error)); \
+        Test_Det_Count = 0; \
+    } while (0)
+
+#define TEST_CHECK_NO_DET()               TEST_CHECK_EQUAL(Test_Det_Count, 0U)
+
+/*******************************************************************************
+ *                              Stubs                                          *
+ *******************************************************************************/
+Std_ReturnType Det_ReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId)
+{
+    (void)InstanceId;
+    Test_Det_Count++;
+    Test_Det_Module = ModuleId;
+    Test_Det_Api    = ApiId;
+    Test_Det_Error  = ErrorId;
+    return E_OK;
+}
+
+Std_ReturnType Irq_Register(Irq_VectorType Vector, Irq_HandlerType Handler, Irq_PriorityType Priority)
+{
+    Test_Irq_Handler[Vector]  = Handler;
+    Test_Irq_Priority[Vector] = Priority;
+    return E_OK;
+}
+
+void Irq_Unregister(Irq_VectorType Vector)
+{
+    Test_Irq_Handler[Vector] = NULL_PTR;
+}
+
+Std_ReturnType Irq_SetPriority(Irq_VectorType Vector, Irq_PriorityType Priority)
+{
+    Test_Irq_Priority[Vector] = Priority;
+    return E_OK;
+}
+
+void Irq_EnableInterrupt(Irq_VectorType Vector)
+{
+    Test_Irq_Enabled[Vector] = TRUE;
+}
+
+void Irq_DisableInterrupt(Irq_VectorType Vector)
+{
+    Test_Irq_Enabled[Vector] = FALSE;
+}
+
+void Irq_ClearPending(Irq_VectorType Vector)
+{
+    (void)Vector;
+}
+
+void SchM_Enter(SchM_ExclusiveAreaType Area)
+{
+    (void)Area;
+}
+
+void SchM_Exit(SchM_ExclusiveAreaType Area)
+{
+    (void)Area;
+}
+
+uint32 Mcu_GetCoreClockHz(void)
+{
+    return 16000000U;
+}
+
+void Os_TraceRecord(uint8 Event, uint8 Id, uint16 Data)
+{
+    (void)Event;
+    (void)Id;
+    (void)Data;
+}
+
+static void Test_Notification(void)
+{
+    Test_Notifications++;
+}
+
+/*******************************************************************************
+ *                              Helpers                                        *
+ *******************************************************************************/
+static void Test_Reset(void)
+{
+    memset(Gpt_Host_Timer, 0, sizeof(Gpt_Host_Timer));
+    memset(Gpt_Host_Sysctl, 0, sizeof(Gpt_Host_Sysctl));
+    /* Every timer module reports ready as soon as its clock is enabled */
+    Gpt_Host_Sysctl[GPT_PRTIMER_REG_OFFSET / 4U]  = 0xFFFFFFFFU;
+    Gpt_Host_Sysctl[GPT_PRWTIMER_REG_OFFSET / 4U] = 0xFFFFFFFFU;
+    memset(Test_Irq_Handler, 0, sizeof(Test_Irq_Handler));
+    memset(Test_Irq_Priority, 0, sizeof(Test_Irq_Priority));
+    memset(Test_Irq_Enabled, 0, sizeof(Test_Irq_Enabled));
+    Test_Det_Count     = 0;
+    Test_Notifications = 0;
+}
+
+/* Interrupt of a sub-timer as the NVIC would take it */
+static void Test_RaiseInterrupt(Irq_VectorType Vector)
+{
+    TEST_CHECK(NULL_PTR != Test_Irq_Handler[Vector]);
+    TEST_CHECK(TRUE == Test_Irq_Enabled[Vector]);
+    if (NULL_PTR != Test_Irq_Handler[Vector])
+    {
+        Test_Irq_Handler[Vector]();
+    }
+}
+
+/*******************************************************************************
+ *                              Tests                                          *
+ *******************************************************************************/
+
+/* 16-bit halves of a timer: one-shot with prescaler on A, continuous with notification on B */
+static void Test_TimerHalves(void)
+{
+    static const Gpt_ConfigType Config = {{
+        { GPT_TIMER_0, GPT_SUBTIMER_A, GPT_CH_MODE_ONESHOT,    9U, NULL_PTR          },
+        { GPT_TIMER_0, GPT_SUBTIMER_B, GPT_CH_MODE_CONTINUOUS, 0U, Test_Notification }
+    }};
+
+    Test_Reset();
+    Gpt_Init(&Config);
+    TEST_CHECK_NO_DET();
+
+    /* Clock, individual 16-bit halves, modes, prescalers and timeout interrupts */
+    TEST_CHECK_EQUAL(Gpt_Host_Sysctl[GPT_RCGCTIMER_REG_OFFSET / 4U], 0x01U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(0, GPT_CFG_REG_OFFSET), 0x04U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(0, GPT_TAMR_REG_OFFSET), 0x01U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(0, TEST_TBMR_REG_OFFSET), 0x02U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(0, GPT_TAPR_REG_OFFSET), 9U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(0, TEST_TBPR_REG_OFFSET), 0U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(0, GPT_IMR_REG_OFFSET), 0x101U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(0, GPT_CTL_REG_OFFSET), 0U);
+    TEST_CHECK_EQUAL(Test_Irq_Priority[TEST_TIMER0A_VECTOR], GPT_INTERRUPT_PRIORITY);
+    TEST_CHECK_EQUAL(Test_Irq_Priority[TEST_TIMER0B_VECTOR], GPT_INTERRUPT_PRIORITY);
+    TEST_CHECK(TRUE == Test_Irq_Enabled[TEST_TIMER0A_VECTOR]);
+    TEST_CHECK(TRUE == Test_Irq_Enabled[TEST_TIMER0B_VECTOR]);
+
+    /* Not started yet */
+    TEST_CHECK_EQUAL(Gpt_GetTimeElapsed(0), 0U);
+    TEST_CHECK_EQUAL(Gpt_GetTimeRemaining(0), 0U);
+
+    Gpt_Init(&Config);
+    TEST_CHECK_DET(GPT_INIT_SID, GPT_E_ALREADY_INITIALIZED);
+
+    /* Timeout values out of the 16-bit range */
+    Gpt_StartTimer(0, 0U);
+    TEST_CHECK_DET(GPT_START_TIMER_SID, GPT_E_PARAM_VALUE);
+    Gpt_StartTimer(0, 0x10001U);
+    TEST_CHECK_DET(GPT_START_TIMER_SID, GPT_E_PARAM_VALUE);
+    Gpt_StartTimer(0, 0x10000U);
+    TEST_CHECK_NO_DET();
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(0, GPT_TAILR_REG_OFFSET), 0xFFFFU);
+    Gpt_StopTimer(0);
+
+    /* One-shot: counts down from Value - 1, the upper bits of the counter hold the prescaler */
+    Gpt_StartTimer(0, 1000U);
+    TEST_CHECK_NO_DET();
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(0, GPT_TAILR_REG_OFFSET), 999U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(0, GPT_TAV_REG_OFFSET), 999U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(0, GPT_CTL_REG_OFFSET), 0x01U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(0, GPT_ICR_REG_OFFSET), 0x01U);
+    TEST_TIMER_REG(0, GPT_TAV_REG_OFFSET) = 0x00050000U | 899U;
+    TEST_CHECK_EQUAL(Gpt_GetTimeElapsed(0), 100U);
+    TEST_CHECK_EQUAL(Gpt_GetTimeRemaining(0), 900U);
+
+    Gpt_StartTimer(0, 1000U);
+    TEST_CHECK_DET(GPT_START_TIMER_SID, GPT_E_BUSY);
+
+    /* Timed out, the interrupt is still pending: the channel is seen expired */
+    TEST_TIMER_REG(0, GPT_TAV_REG_OFFSET) = 0U;
+    TEST_TIMER_REG(0, GPT_RIS_REG_OFFSET) = 0x01U;
+    TEST_CHECK_EQUAL(Gpt_GetTimeElapsed(0), 1000U);
+    TEST_CHECK_EQUAL(Gpt_GetTimeRemaining(0), 0U);
+
+    /* A stop after the timeout leaves the channel to expire */
+    Gpt_StopTimer(0);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(0, GPT_CTL_REG_OFFSET), 0x01U);
+
+    TEST_TIMER_REG(0, GPT_ICR_REG_OFFSET) = 0U;
+    Test_RaiseInterrupt(TEST_TIMER0A_VECTOR);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(0, GPT_ICR_REG_OFFSET), 0x01U);
+    TEST_TIMER_REG(0, GPT_RIS_REG_OFFSET) = 0U;
+    TEST_CHECK_EQUAL(Gpt_GetTimeElapsed(0), 1000U);
+    TEST_CHECK_EQUAL(Gpt_GetTimeRemaining(0), 0U);
+    TEST_CHECK_EQUAL(Test_Notifications, 0U);
+
+    /* Channel 0 has no notification function */
+    Gpt_EnableNotification(0);
+    TEST_CHECK_DET(GPT_ENABLE_NOTIFICATION_SID, GPT_E_PARAM_CHANNEL);
+
+    /* Continuous on timer B: the registers follow the timer A ones, the bits are shifted by 8 */
+    Gpt_StartTimer(1, 50000U);
+    TEST_CHECK_NO_DET();
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(0, GPT_TBILR_REG_OFFSET), 49999U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(0, GPT_TBV_REG_OFFSET), 49999U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(0, GPT_CTL_REG_OFFSET) & 0x100U, 0x100U);
+    TEST_TIMER_REG(0, GPT_TBV_REG_OFFSET) = 0U;
+    TEST_CHECK_EQUAL(Gpt_GetTimeElapsed(1), 49999U);
+    TEST_CHECK_EQUAL(Gpt_GetTimeRemaining(1), 1U);
+
+    /* Timeout with the notification disabled */
+    Test_RaiseInterrupt(TEST_TIMER0B_VECTOR);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(0, GPT_ICR_REG_OFFSET), 0x100U);
+    TEST_CHECK_EQUAL(Test_Notifications, 0U);
+
+    /* Timeout with the notification enabled, the channel keeps running from the reload value */
+    Gpt_EnableNotification(1);
+    TEST_CHECK_NO_DET();
+    TEST_TIMER_REG(0, GPT_TBV_REG_OFFSET) = 49999U;
+    Test_RaiseInterrupt(TEST_TIMER0B_VECTOR);
+    TEST_CHECK_EQUAL(Test_Notifications, 1U);
+    TEST_CHECK_EQUAL(Gpt_GetTimeElapsed(1), 0U);
+    TEST_CHECK_EQUAL(Gpt_GetTimeRemaining(1), 50000U);
+
+    Gpt_DisableNotification(1);
+    Test_RaiseInterrupt(TEST_TIMER0B_VECTOR);
+    TEST_CHECK_EQUAL(Test_Notifications, 1U);
+
+    Gpt_DeInit();
+    TEST_CHECK_DET(GPT_DEINIT_SID, GPT_E_BUSY);
+
+    /* Stopped: the elapsed time is frozen, timer A is left alone */
+    TEST_TIMER_REG(0, GPT_CTL_REG_OFFSET) = 0x101U;
+    TEST_TIMER_REG(0, GPT_TBV_REG_OFFSET) = 30000U;
+    Gpt_StopTimer(1);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(0, GPT_CTL_REG_OFFSET), 0x01U);
+    TEST_TIMER_REG(0, GPT_TBV_REG_OFFSET) = 100U;
+    TEST_CHECK_EQUAL(Gpt_GetTimeElapsed(1), 19999U);
+    TEST_CHECK_EQUAL(Gpt_GetTimeRemaining(1), 30001U);
+
+    Gpt_DeInit();
+    TEST_CHECK_NO_DET();
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(0, GPT_IMR_REG_OFFSET), 0U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(0, GPT_CTL_REG_OFFSET), 0U);
+    TEST_CHECK(NULL_PTR == Test_Irq_Handler[TEST_TIMER0A_VECTOR]);
+    TEST_CHECK(NULL_PTR == Test_Irq_Handler[TEST_TIMER0B_VECTOR]);
+    TEST_CHECK(FALSE == Test_Irq_Enabled[TEST_TIMER0A_VECTOR]);
+    TEST_CHECK(FALSE == Test_Irq_Enabled[TEST_TIMER0B_VECTOR]);
+
+    Gpt_GetTimeElapsed(0);
+    TEST_CHECK_DET(GPT_GET_TIME_ELAPSED_SID, GPT_E_UNINIT);
+}
+
+/* Concatenated halves: 32-bit continuous on a timer, 64-bit one-shot on a wide timer */
+static void Test_Concatenated(void)
+{
+    static const Gpt_ConfigType Config = {{
+        { GPT_TIMER_1,      GPT_SUBTIMER_CONCATENATED, GPT_CH_MODE_CONTINUOUS, 0U, Test_Notification },
+        { GPT_WIDE_TIMER_0, GPT_SUBTIMER_CONCATENATED, GPT_CH_MODE_ONESHOT,    0U, Test_Notification }
+    }};
+
+    Test_Reset();
+    Gpt_Init(&Config);
+    TEST_CHECK_NO_DET();
+
+    TEST_CHECK_EQUAL(Gpt_Host_Sysctl[GPT_RCGCTIMER_REG_OFFSET / 4U], 0x02U);
+    TEST_CHECK_EQUAL(Gpt_Host_Sysctl[GPT_RCGCWTIMER_REG_OFFSET / 4U], 0x01U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(1, GPT_CFG_REG_OFFSET), 0x00U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(1, GPT_TAMR_REG_OFFSET), 0x02U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(1, GPT_IMR_REG_OFFSET), 0x01U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(6, GPT_CFG_REG_OFFSET), 0x00U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(6, GPT_TAMR_REG_OFFSET), 0x01U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(6, GPT_IMR_REG_OFFSET), 0x01U);
+    TEST_CHECK(NULL_PTR != Test_Irq_Handler[TEST_TIMER1A_VECTOR]);
+    TEST_CHECK(NULL_PTR != Test_Irq_Handler[TEST_WTIMER0A_VECTOR]);
+
+    /* 32-bit: the whole counter is used, not only the lower 16 bits */
+    Gpt_StartTimer(0, 0x100000001ULL);
+    TEST_CHECK_DET(GPT_START_TIMER_SID, GPT_E_PARAM_VALUE);
+    Gpt_StartTimer(0, 0x100000000ULL);
+    TEST_CHECK_NO_DET();
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(1, GPT_TAILR_REG_OFFSET), 0xFFFFFFFFU);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(1, GPT_CTL_REG_OFFSET), 0x01U);
+    TEST_TIMER_REG(1, GPT_TAV_REG_OFFSET) = 0x00012345U;
+    TEST_CHECK_EQUAL(Gpt_GetTimeElapsed(0), 0xFFFFFFFFU - 0x00012345U);
+    TEST_CHECK_EQUAL(Gpt_GetTimeRemaining(0), 0x00012346U);
+
+    /* 64-bit: timer A holds the lower and timer B the upper 32 bits */
+    Gpt_StartTimer(1, 0x100000005ULL);
+    TEST_CHECK_NO_DET();
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(6, GPT_TAILR_REG_OFFSET), 4U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(6, GPT_TBILR_REG_OFFSET), 1U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(6, GPT_TAV_REG_OFFSET), 4U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(6, GPT_TBV_REG_OFFSET), 1U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(6, GPT_CTL_REG_OFFSET), 0x01U);
+    TEST_TIMER_REG(6, GPT_TAV_REG_OFFSET) = 0xFFFFFFFFU;
+    TEST_TIMER_REG(6, GPT_TBV_REG_OFFSET) = 0U;
+    TEST_CHECK_EQUAL(Gpt_GetTimeElapsed(1), 5U);
+    TEST_CHECK_EQUAL(Gpt_GetTimeRemaining(1), 0x100000000ULL);
+
+    /* One-shot expiry with the notification enabled */
+    Gpt_EnableNotification(1);
+    TEST_TIMER_REG(6, GPT_RIS_REG_OFFSET) = 0x01U;
+    Test_RaiseInterrupt(TEST_WTIMER0A_VECTOR);
+    TEST_TIMER_REG(6, GPT_RIS_REG_OFFSET) = 0U;
+    TEST_CHECK_EQUAL(Test_Notifications, 1U);
+    TEST_CHECK_EQUAL(Gpt_GetTimeElapsed(1), 0x100000005ULL);
+    TEST_CHECK_EQUAL(Gpt_GetTimeRemaining(1), 0U);
+
+    /* An expired one-shot channel can be restarted */
+    Gpt_StartTimer(1, 2U);
+    TEST_CHECK_NO_DET();
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(6, GPT_TAILR_REG_OFFSET), 1U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(6, GPT_TBILR_REG_OFFSET), 0U);
+
+    Gpt_StopTimer(0);
+    Gpt_StopTimer(1);
+    Gpt_DeInit();
+    TEST_CHECK_NO_DET();
+    TEST_CHECK(NULL_PTR == Test_Irq_Handler[TEST_TIMER1A_VECTOR]);
+    TEST_CHECK(NULL_PTR == Test_Irq_Handler[TEST_WTIMER0A_VECTOR]);
+}
+
+/* 32-bit halves of a wide timer with 16-bit prescalers */
+static void Test_WideTimerHalves(void)
+{
+    static const Gpt_ConfigType Config = {{
+        { GPT_WIDE_TIMER_1, GPT_SUBTIMER_A, GPT_CH_MODE_CONTINUOUS, 0xFFFFU, NULL_PTR          },
+        { GPT_WIDE_TIMER_1, GPT_SUBTIMER_B, GPT_CH_MODE_ONESHOT,    0x1234U, Test_Notification }
+    }};
+
+    Test_Reset();
+    Gpt_Init(&Config);
+    TEST_CHECK_NO_DET();
+
+    TEST_CHECK_EQUAL(Gpt_Host_Sysctl[GPT_RCGCWTIMER_REG_OFFSET / 4U], 0x02U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(7, GPT_CFG_REG_OFFSET), 0x04U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(7, GPT_TAMR_REG_OFFSET), 0x02U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(7, TEST_TBMR_REG_OFFSET), 0x01U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(7, GPT_TAPR_REG_OFFSET), 0xFFFFU);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(7, TEST_TBPR_REG_OFFSET), 0x1234U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(7, GPT_IMR_REG_OFFSET), 0x101U);
+
+    /* 32-bit half: the upper 16 bits of the counter count too */
+    Gpt_StartTimer(0, 0x100000001ULL);
+    TEST_CHECK_DET(GPT_START_TIMER_SID, GPT_E_PARAM_VALUE);
+    Gpt_StartTimer(0, 0x100000000ULL);
+    TEST_CHECK_NO_DET();
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(7, GPT_TAILR_REG_OFFSET), 0xFFFFFFFFU);
+    TEST_TIMER_REG(7, GPT_TAV_REG_OFFSET) = 0x80000000U;
+    TEST_CHECK_EQUAL(Gpt_GetTimeElapsed(0), 0x7FFFFFFFU);
+    TEST_CHECK_EQUAL(Gpt_GetTimeRemaining(0), 0x80000001U);
+
+    Gpt_StartTimer(1, 10U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(7, GPT_TBILR_REG_OFFSET), 9U);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(7, GPT_CTL_REG_OFFSET), 0x101U);
+    TEST_TIMER_REG(7, GPT_TBV_REG_OFFSET) = 3U;
+    TEST_CHECK_EQUAL(Gpt_GetTimeElapsed(1), 6U);
+    TEST_CHECK_EQUAL(Gpt_GetTimeRemaining(1), 4U);
+
+    /* Expired on timer B, its flag does not affect timer A */
+    TEST_TIMER_REG(7, GPT_RIS_REG_OFFSET) = 0x100U;
+    TEST_CHECK_EQUAL(Gpt_GetTimeElapsed(1), 10U);
+    TEST_CHECK_EQUAL(Gpt_GetTimeElapsed(0), 0x7FFFFFFFU);
+    Test_RaiseInterrupt(TEST_WTIMER1B_VECTOR);
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(7, GPT_ICR_REG_OFFSET), 0x100U);
+    TEST_CHECK_EQUAL(Test_Notifications, 0U);
+
+    Gpt_StopTimer(0);
+    Gpt_DeInit();
+    TEST_CHECK_NO_DET();
+    TEST_CHECK(NULL_PTR == Test_Irq_Handler[TEST_WTIMER1A_VECTOR]);
+    TEST_CHECK(NULL_PTR == Test_Irq_Handler[TEST_WTIMER1B_VECTOR]);
+}
+
+/* Configuration rejected by Gpt_Init, the driver stays uninitialized */
+static void Test_RejectConfig(const Gpt_ConfigType * Config)
+{
+    Gpt_Init(Config);
+    TEST_CHECK_DET(GPT_INIT_SID, GPT_E_PARAM_CONFIG);
+    Gpt_GetTimeElapsed(0);
+    TEST_CHECK_DET(GPT_GET_TIME_ELAPSED_SID, GPT_E_UNINIT);
+}
+
+static void Test_CheckConfig(void)
+{
+    static const Gpt_ConfigType Valid = {{
+        { GPT_TIMER_2, GPT_SUBTIMER_A, GPT_CH_MODE_CONTINUOUS, 0xFFU, NULL_PTR },
+        { GPT_TIMER_2, GPT_SUBTIMER_B, GPT_CH_MODE_ONESHOT,    0U,    NULL_PTR }
+    }};
+    Gpt_ConfigType Config;
+    uint8 Vector;
+
+    Test_Reset();
+
+    Gpt_Init(NULL_PTR);
+    TEST_CHECK_DET(GPT_INIT_SID, GPT_E_PARAM_POINTER);
+
+    /* Out of range enums */
+    Config = Valid;
+    Config.Channels[1].Timer = (Gpt_HwTimerType)(GPT_WIDE_TIMER_5 + 1);
+    Test_RejectConfig(&Config);
+
+    Config = Valid;
+    Config.Channels[1].SubTimer = (Gpt_SubTimerType)(GPT_SUBTIMER_CONCATENATED + 1);
+    Test_RejectConfig(&Config);
+
+    Config = Valid;
+    Config.Channels[0].Mode = (Gpt_ChannelModeType)(GPT_CH_MODE_ONESHOT + 1);
+    Test_RejectConfig(&Config);
+
+    /* Wide Timer 5A is the Os budget timer */
+    Config = Valid;
+    Config.Channels[1].Timer = GPT_WIDE_TIMER_5;
+    Test_RejectConfig(&Config);
+
+    /* No prescaler on the concatenated halves */
+    Config = Valid;
+    Config.Channels[1].Timer    = GPT_TIMER_3;
+    Config.Channels[1].SubTimer = GPT_SUBTIMER_CONCATENATED;
+    Config.Channels[1].Prescale = 1U;
+    Test_RejectConfig(&Config);
+
+    /* 8-bit prescaler on a timer half */
+    Config = Valid;
+    Config.Channels[0].Prescale = 0x100U;
+    Test_RejectConfig(&Config);
+
+    /* Every half serves one channel */
+    Config = Valid;
+    Config.Channels[1].SubTimer = GPT_SUBTIMER_A;
+    Test_RejectConfig(&Config);
+
+    Config = Valid;
+    Config.Channels[1].SubTimer = GPT_SUBTIMER_CONCATENATED;
+    Config.Channels[1].Prescale = 0U;
+    Test_RejectConfig(&Config);
+
+    /* Nothing was touched by the rejected configurations */
+    for (Vector = 0; Vector < IRQ_VECTOR_COUNT; Vector++)
+    {
+        TEST_CHECK(NULL_PTR == Test_Irq_Handler[Vector]);
+    }
+    TEST_CHECK_EQUAL(Gpt_Host_Sysctl[GPT_RCGCTIMER_REG_OFFSET / 4U], 0U);
+
+    /* The limits themselves are accepted */
+    Gpt_Init(&Valid);
+    TEST_CHECK_NO_DET();
+    TEST_CHECK_EQUAL(TEST_TIMER_REG(2, GPT_TAPR_REG_OFFSET), 0xFFU);
+    Gpt_DeInit();
+    TEST_CHECK_NO_DET();
+}
+
+int main(void)
+{
+    Test_CheckConfig();
+    Test_TimerHalves();
+    Test_Concatenated();
+    Test_WideTimerHalves();
+    return TEST_RESULT("Gpt_Test");
+}
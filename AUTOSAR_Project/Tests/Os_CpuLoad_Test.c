@@ -0,0 +1,264 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_CpuLoad_Test.c
+ *
+ * Description: Host test of the CPU load measurement of the Os against a
+ *              simulated SysTick. The SysTick driver of Gpt.c counts the ticks
+ *              on the RAM registers of Gpt_HostRegs.h, the test sets the
+ *              counter and calls SysTick_Handler as the hardware would. There
+ *              is no DWT cycle counter (Os_TimingInit is not called), so the
+ *              timestamps of the idle hooks and of the tick come from the
+ *              SysTick fallback of Os_TimingGetTimestamp.
+ *              The Os configuration of the test is set by the Makefile.
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Gpt_HostRegs.h"
+#include "Gpt.h"
+#include "Gpt_Regs.h"
+#include "Irq.h"
+#include "SchM.h"
+#include "Mcu.h"
+#include "Det.h"
+#include "Os_Kernel.h"
+#include "Os_Trace.h"
+
+#if (OS_CPU_LOAD_MEASUREMENT != STD_ON) || (OS_CPU_LOAD_WINDOW_TICKS != 2U)
+#error "Os_CpuLoad_Test expects the CPU load configuration of the Makefile"
+#endif
+
+/* 1 ms tick at 16 MHz */
+#define TEST_CORE_CLOCK_HZ                (16000000U)
+#define TEST_TICK_US                      (1000U)
+#define TEST_TICK_CYCLES                  (16000U)
+
+/* Cycles from the end of a tick period to the call of the tick */
+#define TEST_TICK_LATENCY                 (100U)
+
+/* Interrupt Control and State Register: SysTick pending */
+#define TEST_PENDSTSET_MASK               (0x04000000U)
+
+/* SysTick ISR of Gpt.c, its vector is in the startup file */
+extern void SysTick_Handler(void);
+
+/* Tick counter of the Os, counted by the tick callback */
+static uint32 Test_Tick_Counter = 0;
+
+#define TEST_CHECK_LOAD(Current_Load, Windowed_Load, Peak_Load) \
+    do { \
+        Os_CpuLoadType Test_Load; \
+        TEST_CHECK_EQUAL(Os_GetCpuLoad(&Test_Load), E_OK); \
+        TEST_CHECK_EQUAL(Test_Load.Current, (Current_Load)); \
+        TEST_CHECK_EQUAL(Test_Load.Windowed, (Windowed_Load)); \
+        TEST_CHECK_EQUAL(Test_Load.Peak, (Peak_Load)); \
+    } while (0)
+
+/*******************************************************************************
+ *                              Stubs                                          *
+ *******************************************************************************/
+Std_ReturnType Det_ReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId)
+{
+    printf("unexpected Det error: module %u api %u error %u\n",
+           (unsigned int)ModuleId, (unsigned int)ApiId, (unsigned int)ErrorId);
+    (void)InstanceId;
+    Test_Failures++;
+    return E_OK;
+}
+
+Std_ReturnType Irq_Register(Irq_VectorType Vector, Irq_HandlerType Handler, Irq_PriorityType Priority)
+{
+    (void)Vector;
+    (void)Handler;
+    (void)Priority;
+    return E_OK;
+}
+
+void Irq_Unregister(Irq_VectorType Vector)
+{
+    (void)Vector;
+}
+
+Std_ReturnType Irq_SetPriority(Irq_VectorType Vector, Irq_PriorityType Priority)
+{
+    (void)Vector;
+    (void)Priority;
+    return E_OK;
+}
+
+void Irq_EnableInterrupt(Irq_VectorType Vector)
+{
+    (void)Vector;
+}
+
+void Irq_DisableInterrupt(Irq_VectorType Vector)
+{
+    (void)Vector;
+}
+
+void Irq_ClearPending(Irq_VectorType Vector)
+{
+    (void)Vector;
+}
+
+void SchM_Enter(SchM_ExclusiveAreaType Area)
+{
+    (void)Area;
+}
+
+void SchM_Exit(SchM_ExclusiveAreaType Area)
+{
+    (void)Area;
+}
+
+uint32 Mcu_GetCoreClockHz(void)
+{
+    return TEST_CORE_CLOCK_HZ;
+}
+
+void Os_TraceRecord(uint8 Event, uint8 Id, uint16 Data)
+{
+    (void)Event;
+    (void)Id;
+    (void)Data;
+}
+
+uint32 Os_KernelGetTickCounter(void)
+{
+    return Test_Tick_Counter;
+}
+
+/* Single threaded host: nothing to mask */
+uint32 Os_CpuSaveAndDisable(void)
+{
+    return 0;
+}
+
+void Os_CpuRestore(uint32 Primask)
+{
+    (void)Primask;
+}
+
+uint32 Os_CpuHighestBit(uint32 Value)
+{
+    uint32 Bit = 31U;
+
+    while ((Value & ((uint32)1 << Bit)) == 0)
+    {
+        Bit--;
+    }
+    return Bit;
+}
+
+/*******************************************************************************
+ *                              Helpers                                        *
+ *******************************************************************************/
+
+/* Tick callback doing the CPU load part of Os_NewTimerTick */
+static void Test_NewTimerTick(void)
+{
+    Test_Tick_Counter++;
+    Os_CpuLoadTick(Os_TimingGetTimestamp(), Test_Tick_Counter);
+}
+
+/* Time Cycles (1 .. TEST_TICK_CYCLES) into the current tick period, the SysTick counts down */
+static void Test_At(uint32 Cycles)
+{
+    GPT_SYSTICK_CURRENT_REG = TEST_TICK_CYCLES - Cycles;
+}
+
+/* SysTick interrupt Ticks periods after the last one, the first Ticks - 1 of them slept through
+ * in a tickless period and added by the Os_Idle catch-up */
+static void Test_Tick(uint32 Ticks)
+{
+    Test_Tick_Counter += Ticks - 1U;
+    Test_At(TEST_TICK_LATENCY);
+    SysTick_Handler();
+}
+
+/*******************************************************************************
+ *                              Test                                           *
+ *******************************************************************************/
+int main(void)
+{
+    TEST_CHECK_EQUAL(Os_GetCpuLoad(NULL_PTR), E_NOT_OK);
+
+    SysTick_SetCallBack(Test_NewTimerTick);
+    SysTick_Start(TEST_TICK_US);
+    TEST_CHECK_EQUAL(GPT_SYSTICK_RELOAD_REG, TEST_TICK_CYCLES - 1U);
+    TEST_CHECK_EQUAL(GPT_SYSTICK_CTRL_REG, 0x07U);
+    TEST_CHECK_EQUAL(SysTick_GetTickCycles(), TEST_TICK_CYCLES);
+
+    /* SysTick fallback of the timestamps: counted ticks plus the cycles of the current one */
+    Test_At(500U);
+    TEST_CHECK_EQUAL(Os_TimingGetTimestamp(), 500U);
+
+    /* The first tick only starts the measurement */
+    Os_KernelIdleStart();
+    Test_Tick(1U);
+    TEST_CHECK_EQUAL(Test_Tick_Counter, 1U);
+    TEST_CHECK_EQUAL(Os_TimingGetTimestamp(), TEST_TICK_CYCLES + TEST_TICK_LATENCY);
+    Os_KernelIdleEnd();
+    TEST_CHECK_LOAD(0U, 0U, 0U);
+
+    /* Normal tick: 4000 idle cycles of 16000, the window is not complete yet */
+    Test_At(4100U);
+    Os_KernelIdleStart();
+    Test_At(8100U);
+    Os_KernelIdleEnd();
+    Test_Tick(1U);
+    TEST_CHECK_LOAD(750U, 0U, 750U);
+
+    /* Idle period running over the tick: split at the tick between the two intervals */
+    Test_At(8100U);
+    Os_KernelIdleStart();
+    Test_Tick(1U);
+    TEST_CHECK_LOAD(500U, 625U, 750U);
+    Test_At(4100U);
+    Os_KernelIdleEnd();
+    Test_Tick(1U);
+    TEST_CHECK_LOAD(750U, 625U, 750U);
+
+    /* Tickless idle: one interval over 5 ticks, 1000 busy cycles of 80000, closes the window
+     * that holds 1 tick */
+    Test_At(1100U);
+    Os_KernelIdleStart();
+    Test_Tick(5U);
+    TEST_CHECK_EQUAL(Test_Tick_Counter, 9U);
+    TEST_CHECK_LOAD(12U, (13000U * 1000U) / 96000U, 750U);
+    Test_At(1100U);
+    Os_KernelIdleEnd();
+
+    /* Window rollover after OS_CPU_LOAD_WINDOW_TICKS ticks */
+    Test_Tick(1U);
+    TEST_CHECK_LOAD(937U, 135U, 937U);
+    Test_Tick(1U);
+    TEST_CHECK_LOAD(1000U, 968U, 1000U);
+
+    /* The next window starts empty, a repeated idle start keeps the first timestamp */
+    Test_At(TEST_TICK_LATENCY);
+    Os_KernelIdleStart();
+    Test_At(4100U);
+    Os_KernelIdleStart();
+    Test_At(8100U);
+    Os_KernelIdleEnd();
+    Test_Tick(1U);
+    TEST_CHECK_LOAD(500U, 968U, 1000U);
+
+    Os_ResetPeakCpuLoad();
+    TEST_CHECK_LOAD(500U, 968U, 0U);
+    Test_Tick(1U);
+    TEST_CHECK_LOAD(1000U, 750U, 1000U);
+
+    /* A tick expired but not served yet is counted in the timestamp: the counter reloaded and
+     * already counted the latency of the next tick */
+    GPT_INTCTRL_REG = TEST_PENDSTSET_MASK;
+    Test_At(TEST_TICK_LATENCY);
+    TEST_CHECK_EQUAL(Os_TimingGetTimestamp(), ((Test_Tick_Counter + 1U) * TEST_TICK_CYCLES) + TEST_TICK_LATENCY);
+    GPT_INTCTRL_REG = 0U;
+
+    return TEST_RESULT("Os_CpuLoad_Test");
+}
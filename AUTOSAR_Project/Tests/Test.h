@@ -0,0 +1,48 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Test.h
+ *
+ * Description: Checks shared by the host tests. A failed check is printed and
+ *              counted, the test keeps running and main returns the count.
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+
+#ifndef TEST_H
+#define TEST_H
+
+#include <stdio.h>
+#include "Std_Types.h"
+
+/* Failed checks of the test program */
+static uint32 Test_Failures = 0;
+
+#define TEST_CHECK(Condition) \
+    do { \
+        if (!(Condition)) \
+        { \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            Test_Failures++; \
+        } \
+    } while (0)
+
+#define TEST_CHECK_EQUAL(Actual, Expected) \
+    do { \
+        uint64 Test_Actual   = (uint64)(Actual); \
+        uint64 Test_Expected = (uint64)(Expected); \
+        if (Test_Actual != Test_Expected) \
+        { \
+            printf("%s:%d: check failed: %s is 0x%llX, expected 0x%llX\n", __FILE__, __LINE__, \
+                   #Actual, (unsigned long long)Test_Actual, (unsigned long long)Test_Expected); \
+            Test_Failures++; \
+        } \
+    } while (0)
+
+/* Summary line and exit code of the test program */
+#define TEST_RESULT(Name) \
+    ((0 == Test_Failures) ? (printf("%s: passed\n", (Name)), 0) \
+                          : (printf("%s: %u check(s) failed\n", (Name), (unsigned int)Test_Failures), 1))
+
+#endif /* TEST_H */
@@ -0,0 +1,773 @@
+#!/usr/bin/env python3
+###############################################################################
+#
+# Module: Os
+#
+# File Name: Os_Gen.py
+#
+# Description: Configuration generator for the Os Scheduler. Reads the task
+#              set from Os_Cfg.json and generates Os_Cfg.h and Os_PBcfg.c,
+#              including the hyperperiod and the precomputed dispatch table.
+#              With "OffsetAssignment": "Auto" it also chooses the task offsets
+#              that flatten the load per tick. Runs as a CCS pre-build step.
+#
+# Author: Mohannad Sabry
+###############################################################################
+
+import argparse
+import json
+import math
+import os
+import re
+import sys
+
+PROJECT_DIR = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+
+# Upper limit for the hyperperiod in ticks, the tick counter is a uint16
+MAX_HYPERPERIOD_TICKS = 0xFFFF
+
+# Pre-compile switches: (key in Os_Cfg.json, macro in Os_Cfg.h, default, comment)
+SWITCHES = [
+    ('TicklessIdle', 'OS_TICKLESS_IDLE', False,
+     'Pre-compile option for the tickless idle mode: sleep until the next expiry point'),
+    ('ExecutionTimeMeasurement', 'OS_EXECUTION_TIME_MEASUREMENT', False,
+     'Pre-compile option for the measurement of the task execution times (DWT cycle counter)'),
+    ('CpuLoadMeasurement', 'OS_CPU_LOAD_MEASUREMENT', False,
+     'Pre-compile option for the measurement of the CPU load from the idle time'),
+    ('StackMonitoring', 'OS_STACK_MONITORING', False,
+     'Pre-compile option for the stack high-water marks and the stack canary check on every tick'),
+    ('Alarms', 'OS_ALARMS', False,
+     'Pre-compile option for the alarm service (timing wheel, callbacks run by Os_AlarmTask)'),
+    ('Trace', 'OS_TRACE', False,
+     'Pre-compile option for the trace recorder (task, ISR and marker records in a RAM ring buffer)'),
+    ('TimingProtection', 'OS_TIMING_PROTECTION', False,
+     'Pre-compile option for the task execution budgets (WTIMER5A) and deadlines with a protection hook'),
+    ('LogicalExecutionTime', 'OS_LET', False,
+     'Pre-compile option for the logical execution time: task inputs latched and outputs published by the tick'),
+]
+
+# Macros the build may define itself, e.g. the host tests with their own CPU load configuration
+BUILD_OVERRIDABLE = ('OS_CPU_LOAD_MEASUREMENT', 'OS_CPU_LOAD_WINDOW_TICKS')
+
+# Event task added by the generator to run the alarm callbacks
+ALARM_TASK_NAME = 'Os_AlarmTask'
+
+# Event task added by the generator to run the jobs of the aperiodic server
+SERVER_TASK_NAME = 'Os_ServerTask'
+
+# Upper bound of the job queue of the aperiodic server, its indexes are uint16
+MAX_SERVER_JOB_COUNT = 0xFFFF
+
+# Pre-compile options with a fixed set of values: (key, macro, default, {value: C macro}, comment)
+OPTIONS = [
+    ('TickOverrunMode', 'OS_TICK_OVERRUN_MODE', 'CatchUp',
+     {'CatchUp': 'OS_OVERRUN_CATCH_UP', 'Skip': 'OS_OVERRUN_SKIP'},
+     'Pre-compile option for the ticks missed while a task runs too long: catch up or skip them'),
+    ('SchedulingMode', 'OS_SCHEDULING_MODE', 'Cooperative',
+     {'Cooperative': 'OS_SCHEDULING_COOPERATIVE', 'Preemptive': 'OS_SCHEDULING_PREEMPTIVE',
+      'Nvic': 'OS_SCHEDULING_NVIC'},
+     'Pre-compile option for the task scheduling: cooperative executive, preemptive kernel or NVIC tasks'),
+]
+
+# Default stack sizes in bytes for the preemptive mode
+DEFAULT_STACK_SIZE = 256
+DEFAULT_IDLE_STACK_SIZE = 256
+
+# Default number of records of the trace ring buffer (8 bytes each)
+DEFAULT_TRACE_RECORD_COUNT = 256
+
+# The ready priorities of the preemptive kernel are one bit each in a uint32
+MAX_TASK_COUNT = 32
+
+# NVIC mode: spare IRQs available for the tasks (SSI2, SSI3, UART3 - UART7)
+MAX_NVIC_TASK_COUNT = 7
+
+# Clock of the CPU, converts the measured cycles into microseconds
+DEFAULT_CPU_CLOCK_HZ = 16000000
+
+# Offset assignment: improvement passes over all the tasks after the first placement
+MAX_OFFSET_PASSES = 16
+
+# Upper bound of the number of schedules, Os_ScheduleType is a uint8
+MAX_SCHEDULE_COUNT = 255
+
+# Line printed by Os_DumpExecutionTimes for every task on the SWO channel
+EXECUTION_TIME_LINE = re.compile(r'Os task (\d+): n=(\d+) min=\d+ mean=\d+ max=(\d+)')
+
+# Longest execution budget, its cycle count has to fit the 32-bit budget timer
+MAX_BUDGET_US = 100000000
+
+# NVIC mode: the task IRQs get the NVIC priorities below the SysTick one
+# (GPT_SYSTICK_INTERRUPT_PRIORITY in Gpt_Cfg.h) down to 7
+SYSTICK_IRQ_PRIORITY = 3
+LOWEST_IRQ_PRIORITY = 7
+
+FILE_HEADER = """ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: {name}
+ *
+ * Description: {description}
+ *              Generated by Tools/Os_Gen.py from Os_Cfg.json - do not edit.
+ *
+ * Author: Mohannad Sabry
+ ******************************************************************************/
+"""
+
+
+class ConfigError(Exception):
+    pass
+
+
+def lcm(a, b):
+    return a * b // math.gcd(a, b)
+
+
+def to_ticks(task, key, base):
+    value = task.get(key, 0)
+    if value % base != 0:
+        raise ConfigError('%s: %s = %d ms is not a multiple of BaseTimeMs (%d ms)'
+                          % (task['Name'], key, value, base))
+    return value // base
+
+
+def load_config(path):
+    with open(path) as f:
+        cfg = json.load(f)
+
+    base = cfg['BaseTimeMs']
+    if base <= 0:
+        raise ConfigError('BaseTimeMs must be positive')
+
+    task_list = list(cfg['Tasks'])
+    if cfg.get('Alarms'):
+        # Alarms expire with a one tick resolution, their task gets the priority of a one tick deadline
+        task_list.append({'Name': ALARM_TASK_NAME, 'DeadlineMs': base})
+        cfg.setdefault('Includes', []).append('Os_Alarm.h')
+    server = cfg.get('AperiodicServer')
+    if server:
+        load_server(server, base)
+        # The server is a periodic task of its budget for the other tasks, it gets the priority of its period
+        task_list.append({'Name': SERVER_TASK_NAME, 'DeadlineMs': server['PeriodMs']})
+        cfg.setdefault('Includes', []).append('Os_Server.h')
+
+    tasks = []
+    names = set()
+    for task in task_list:
+        name = task['Name']
+        if name in names:
+            raise ConfigError('%s: declared twice' % name)
+        names.add(name)
+
+        if 'PeriodMs' in task:
+            period = to_ticks(task, 'PeriodMs', base)
+            offset = to_ticks(task, 'OffsetMs', base)
+            if period == 0:
+                raise ConfigError('%s: PeriodMs must be at least BaseTimeMs' % name)
+            if offset >= period:
+                raise ConfigError('%s: OffsetMs must be smaller than PeriodMs' % name)
+            deadline = to_ticks(task, 'DeadlineMs', base) if 'DeadlineMs' in task else period
+            if deadline == 0 or deadline > period:
+                raise ConfigError('%s: DeadlineMs must be from BaseTimeMs to PeriodMs' % name)
+        else:
+            # Event task, only runs when activated by Os_ActivateTask
+            if 'OffsetMs' in task:
+                raise ConfigError('%s: an event task (no PeriodMs) has no OffsetMs' % name)
+            if 'LetInput' in task or 'LetOutput' in task:
+                raise ConfigError('%s: an event task (no PeriodMs) has no LET period for LetInput/LetOutput' % name)
+            period, offset = 0, 0
+            deadline = to_ticks(task, 'DeadlineMs', base) if task.get('DeadlineMs') else None
+
+        stack_size = task.get('StackSize', DEFAULT_STACK_SIZE)
+        if stack_size % 8 != 0 or stack_size < 128:
+            raise ConfigError('%s: StackSize must be a multiple of 8 and at least 128 bytes' % name)
+
+        budget = task.get('BudgetUs', 0)
+        if budget < 0 or budget > MAX_BUDGET_US:
+            raise ConfigError('%s: BudgetUs must be 0 (no budget) to %d us' % (name, MAX_BUDGET_US))
+        if deadline and budget > deadline * base * 1000:
+            raise ConfigError('%s: BudgetUs is longer than the deadline' % name)
+        wcet = task.get('WcetUs', 0)
+        if wcet < 0:
+            raise ConfigError('%s: WcetUs must not be negative' % name)
+
+        tasks.append({'Name': name, 'Period': period, 'Offset': offset, 'Deadline': deadline,
+                      'Budget': budget, 'Wcet': wcet, 'AutoOffset': period > 0 and 'OffsetMs' not in task,
+                      'LetInput': task.get('LetInput'), 'LetOutput': task.get('LetOutput'),
+                      'Priority': task.get('Priority'), 'StackSize': stack_size})
+
+    if not any(task['Period'] for task in tasks):
+        raise ConfigError('no periodic tasks configured')
+    if len(tasks) > MAX_TASK_COUNT:
+        raise ConfigError('at most %d tasks are supported' % MAX_TASK_COUNT)
+    assign_priorities(tasks)
+    if cfg.get('SchedulingMode') == 'Nvic':
+        if len(tasks) > MAX_NVIC_TASK_COUNT:
+            raise ConfigError('at most %d tasks are supported in the Nvic scheduling mode' % MAX_NVIC_TASK_COUNT)
+        assign_irq_priorities(tasks)
+    cfg['Queues'] = load_queues(cfg.get('Queues', []))
+    cfg['Resources'] = load_resources(cfg.get('Resources', []), tasks, cfg.get('SchedulingMode') == 'Nvic')
+
+    cfg.setdefault('IdleStackSize', DEFAULT_IDLE_STACK_SIZE)
+    if cfg['IdleStackSize'] % 8 != 0:
+        raise ConfigError('IdleStackSize must be a multiple of 8')
+
+    records = cfg.setdefault('TraceRecords', DEFAULT_TRACE_RECORD_COUNT)
+    if records <= 0 or records & (records - 1) or records > 0x8000:
+        raise ConfigError('TraceRecords must be a power of 2 up to 32768')
+
+    for key, _, default, _ in SWITCHES:
+        if not isinstance(cfg.setdefault(key, default), bool):
+            raise ConfigError('%s must be true or false' % key)
+    for key, _, default, values, _ in OPTIONS:
+        if cfg.setdefault(key, default) not in values:
+            raise ConfigError('%s must be one of %s' % (key, ', '.join(sorted(values))))
+    if cfg.setdefault('OffsetAssignment', 'Manual') not in ('Manual', 'Auto'):
+        raise ConfigError('OffsetAssignment must be Manual or Auto')
+    if cfg.setdefault('CpuClockHz', DEFAULT_CPU_CLOCK_HZ) <= 0:
+        raise ConfigError('CpuClockHz must be positive')
+    if cfg['TimingProtection'] and not cfg.get('ProtectionHook'):
+        raise ConfigError('TimingProtection needs the name of the ProtectionHook function')
+
+    cfg['Tasks'] = tasks
+    return cfg
+
+
+def load_server(server, base):
+    """Check the AperiodicServer entry: BudgetUs per replenishment PeriodMs, and the Jobs queue length."""
+    server['Period'] = to_ticks({'Name': 'AperiodicServer', 'PeriodMs': server['PeriodMs']}, 'PeriodMs', base)
+    if server['Period'] == 0:
+        raise ConfigError('AperiodicServer: PeriodMs must be at least BaseTimeMs')
+    if not 0 < server['BudgetUs'] <= server['Period'] * base * 1000:
+        raise ConfigError('AperiodicServer: BudgetUs must be from 1 us to PeriodMs')
+    if not 0 < server.setdefault('Jobs', 8) <= MAX_SERVER_JOB_COUNT:
+        raise ConfigError('AperiodicServer: Jobs must be from 1 to %d' % MAX_SERVER_JOB_COUNT)
+
+
+def assign_priorities(tasks):
+    """Deadline-monotonic priority assignment: the shorter the deadline, the higher the priority.
+
+    The deadline of a periodic task is its period unless DeadlineMs is given, which
+    makes it rate-monotonic by default. Priorities are unique, 0 is the lowest. Tasks
+    with the same deadline keep their declaration order. Event tasks are placed by
+    their DeadlineMs, below all the periodic tasks without one. A task may fix its
+    priority with "Priority" in Os_Cfg.json, in which case all the tasks must do so.
+    """
+    fixed = [task['Priority'] for task in tasks if task['Priority'] is not None]
+    if fixed:
+        if len(fixed) != len(tasks) or sorted(fixed) != list(range(len(tasks))):
+            raise ConfigError('explicit priorities must be given for all tasks and be unique 0..%d'
+                              % (len(tasks) - 1))
+        return
+    lowest = max(task['Period'] for task in tasks) + 1
+    order = sorted(range(len(tasks)),
+                   key=lambda i: (tasks[i]['Deadline'] if tasks[i]['Deadline'] else lowest, i))
+    for rank, i in enumerate(order):
+        tasks[i]['Priority'] = len(tasks) - 1 - rank
+
+
+def assign_irq_priorities(tasks):
+    """Map the Os priorities onto the NVIC priorities left below SysTick.
+
+    With more tasks than NVIC levels the neighbouring priorities share a level:
+    tasks on the same level never preempt each other, which keeps the order of
+    the priorities and only reduces the number of frames nested on the stack.
+    """
+    levels = LOWEST_IRQ_PRIORITY - SYSTICK_IRQ_PRIORITY
+    for task in tasks:
+        task['IrqPriority'] = LOWEST_IRQ_PRIORITY - task['Priority'] * levels // len(tasks)
+
+
+def load_resources(resources, tasks, nvic):
+    """Immediate priority ceiling of every resource: the highest priority of the tasks using it.
+
+    In the Nvic mode the ceiling is also given as the NVIC priority of the highest task IRQ
+    using the resource, the value BASEPRI is raised to while the resource is held.
+    """
+    by_name = dict((task['Name'], task) for task in tasks)
+    result = []
+    names = set()
+    for resource in resources:
+        name = resource['Name']
+        if name in names:
+            raise ConfigError('resource %s: declared twice' % name)
+        names.add(name)
+        users = resource.get('Tasks', [])
+        if not users:
+            raise ConfigError('resource %s: no task uses it' % name)
+        for user in users:
+            if user not in by_name:
+                raise ConfigError('resource %s: unknown task %s' % (name, user))
+        # Longest time a task holds the resource, only used by the schedulability analysis (Os_Rta.py)
+        entry = {'Name': name, 'Tasks': users, 'MaxHoldUs': resource.get('MaxHoldUs'),
+                 'Ceiling': max(by_name[user]['Priority'] for user in users)}
+        if nvic:
+            entry['IrqCeiling'] = min(by_name[user]['IrqPriority'] for user in users)
+        result.append(entry)
+    return result
+
+
+def load_queues(queues):
+    """Ioc queues: the number of slots is a power of 2 so the free-running indexes wrap cleanly."""
+    result = []
+    names = set()
+    for queue in queues:
+        name = queue['Name']
+        if name in names:
+            raise ConfigError('queue %s: declared twice' % name)
+        names.add(name)
+        length = queue.get('Length', 0)
+        if length < 2 or length > 0x8000 or length & (length - 1):
+            raise ConfigError('queue %s: Length must be a power of 2 from 2 to 32768' % name)
+        size = queue.get('ElementSize', 0)
+        if size < 1 or size > 0xFFFF:
+            raise ConfigError('queue %s: ElementSize must be 1 to 65535 bytes' % name)
+        multi = queue.get('MultiProducer', False)
+        if not isinstance(multi, bool):
+            raise ConfigError('queue %s: MultiProducer must be true or false' % name)
+        result.append({'Name': name, 'Length': length, 'ElementSize': size, 'MultiProducer': multi})
+    return result
+
+
+def load_measured_wcets(cfg, path):
+    """Take the longest measured execution times from a capture of Os_DumpExecutionTimes.
+
+    The lines are matched by task index, a task measured in several captures keeps its
+    longest run. A measured time replaces the declared WcetUs of the task.
+    """
+    tasks = cfg['Tasks']
+    with open(path) as f:
+        for line in f:
+            match = EXECUTION_TIME_LINE.search(line)
+            if not match or int(match.group(2)) == 0:
+                continue
+            index = int(match.group(1))
+            if index >= len(tasks):
+                raise ConfigError('%s: task %d is not configured' % (path, index))
+            wcet = -(-int(match.group(3)) * 1000000 // cfg['CpuClockHz'])
+            task = tasks[index]
+            task['Wcet'] = max(wcet, task['Wcet']) if task.get('Measured') else wcet
+            task['Measured'] = True
+
+
+def hyperperiod_of(tasks):
+    hyperperiod = 1
+    for task in tasks:
+        if task['Period']:
+            hyperperiod = lcm(hyperperiod, task['Period'])
+    if hyperperiod > MAX_HYPERPERIOD_TICKS:
+        raise ConfigError('hyperperiod of %d ticks does not fit the uint16 tick counter' % hyperperiod)
+    return hyperperiod
+
+
+def tick_loads(tasks, hyperperiod):
+    """Sum of the WCETs of the tasks activated on every tick of the hyperperiod."""
+    loads = [0] * hyperperiod
+    for task in tasks:
+        if task['Period']:
+            for tick in range(task['Offset'], hyperperiod, task['Period']):
+                loads[tick] += task['Wcet']
+    return loads
+
+
+def offset_cost(task, offset, others, hyperperiod):
+    """Peak tick load with the task at this offset, and its share of the sum of squares of the tick loads."""
+    ticks = range(offset, hyperperiod, task['Period'])
+    peak = max(max(others), max(others[tick] for tick in ticks) + task['Wcet'])
+    return peak, sum(2 * others[tick] * task['Wcet'] for tick in ticks)
+
+
+def best_offset(task, others, hyperperiod):
+    """Offset of a task giving the lowest peak tick load with the other tasks placed as in others.
+
+    Ties go to the flattest load (lowest sum of squares), then to the earliest offset.
+    """
+    return min(range(task['Period']), key=lambda offset: (offset_cost(task, offset, others, hyperperiod), offset))
+
+
+def assign_offsets(tasks):
+    """Choose the offsets of the periodic tasks without an OffsetMs to minimize the peak tick load.
+
+    The cooperative scheduler runs all the tasks of a tick back to back, so the peak
+    load per tick bounds the response time of the last one. The tasks are placed
+    longest WCET first, then moved one at a time to their best offset against all the
+    others until no move lowers the peak (or the sum of squares of the tick loads).
+    """
+    auto = sorted([task for task in tasks if task['AutoOffset'] and task['Period']], key=lambda task: (-task['Wcet'], task['Period']))
+    missing = [task['Name'] for task in auto if not task['Wcet'] and not task['Budget']]
+    if missing:
+        raise ConfigError('OffsetAssignment Auto needs the WcetUs (or BudgetUs) of %s' % ', '.join(missing))
+    for task in auto:
+        if not task['Wcet']:
+            # The budget bounds the execution time of the run
+            task['Wcet'] = task['Budget']
+
+    hyperperiod = hyperperiod_of(tasks)
+    placed = [task for task in tasks if task['Period'] and not task['AutoOffset']]
+    for task in auto:
+        task['Offset'] = best_offset(task, tick_loads(placed, hyperperiod), hyperperiod)
+        placed.append(task)
+
+    for _ in range(MAX_OFFSET_PASSES):
+        moved = False
+        for task in auto:
+            others = tick_loads([other for other in tasks if other is not task], hyperperiod)
+            offset = best_offset(task, others, hyperperiod)
+            if offset_cost(task, offset, others, hyperperiod) < offset_cost(task, task['Offset'], others, hyperperiod):
+                task['Offset'] = offset
+                moved = True
+        if not moved:
+            break
+
+
+def load_schedules(cfg):
+    """Task sets of the schedules, the first one from the task periods and offsets.
+
+    Each entry of "Schedules" in Os_Cfg.json changes the PeriodsMs (and OffsetsMs) of
+    some periodic tasks, a period of 0 drops the task from the schedule. The first
+    entry is the schedule started by the Os, without "Schedules" it is named Default.
+    """
+    base = cfg['BaseTimeMs']
+    tasks = cfg['Tasks']
+    names = [task['Name'] for task in tasks]
+    entries = cfg.get('Schedules') or [{'Name': 'Default'}]
+    if len(entries) > MAX_SCHEDULE_COUNT:
+        raise ConfigError('at most %d schedules are supported' % MAX_SCHEDULE_COUNT)
+
+    schedules = []
+    for index, entry in enumerate(entries):
+        name = entry['Name']
+        if name in [schedule['Name'] for schedule in schedules]:
+            raise ConfigError('schedule %s: declared twice' % name)
+        periods = entry.get('PeriodsMs', {})
+        offsets = entry.get('OffsetsMs', {})
+        if index == 0 and (periods or offsets):
+            raise ConfigError('schedule %s: the first schedule takes the PeriodMs and OffsetMs of the tasks' % name)
+        for task_name in list(periods) + list(offsets):
+            if task_name not in names:
+                raise ConfigError('schedule %s: unknown task %s' % (name, task_name))
+
+        if index == 0:
+            schedule_tasks = tasks
+        else:
+            schedule_tasks = []
+            for task in tasks:
+                task = dict(task)
+                if task['Name'] in periods:
+                    if not task['Period']:
+                        raise ConfigError('schedule %s: %s is an event task' % (name, task['Name']))
+                    task['Period'] = to_ticks({'Name': task['Name'], 'PeriodMs': periods[task['Name']]},
+                                              'PeriodMs', base)
+                if task['Name'] in offsets:
+                    task['Offset'] = to_ticks({'Name': task['Name'], 'OffsetMs': offsets[task['Name']]},
+                                              'OffsetMs', base)
+                    task['AutoOffset'] = False
+                elif task['Name'] in periods:
+                    task['Offset'] = 0
+                if task['Period']:
+                    if task['Offset'] >= task['Period']:
+                        raise ConfigError('schedule %s: the offset of %s must be smaller than its period'
+                                          % (name, task['Name']))
+                    if task['Deadline'] > task['Period']:
+                        raise ConfigError('schedule %s: the deadline of %s is longer than its period'
+                                          % (name, task['Name']))
+                schedule_tasks.append(task)
+        if not any(task['Period'] for task in schedule_tasks):
+            raise ConfigError('schedule %s: no periodic tasks' % name)
+        schedules.append({'Name': name, 'Tasks': schedule_tasks})
+    return schedules
+
+
+def build_schedule(tasks):
+    """Expand the task set over one hyperperiod.
+
+    Returns the hyperperiod in ticks and the list of expiry points, each one a
+    (tick, [task index, ...]) pair for every tick that activates at least one
+    task. Tasks due on the same tick keep their declaration order.
+    """
+    hyperperiod = hyperperiod_of(tasks)
+
+    expiry_points = []
+    for tick in range(hyperperiod):
+        due = [i for i, task in enumerate(tasks)
+               if task['Period'] and tick % task['Period'] == task['Offset']]
+        if due:
+            expiry_points.append((tick, due))
+    return hyperperiod, expiry_points
+
+
+def task_id_macro(name):
+    return 'OsConf_%s_ID' % name.upper()
+
+
+def queue_id_macro(name):
+    return 'OsConf_%s_QUEUE_ID' % name.upper()
+
+
+def queue_buffer_name(name):
+    return 'Os_IocBuffer_%s' % name
+
+
+def queue_ready_name(name):
+    return 'Os_IocReady_%s' % name
+
+
+def schedule_id_macro(name):
+    return 'OsConf_%s_SCHEDULE_ID' % name.upper()
+
+
+def resource_id_macro(name):
+    return 'OsConf_%s_RESOURCE_ID' % name.upper()
+
+
+def stack_name(name):
+    return 'Os_Stack_%s' % name
+
+
+def cpu_load_window(cfg, hyperperiod):
+    """Window of the averaged CPU load in ticks, one hyperperiod unless CpuLoadWindowMs is given."""
+    if 'CpuLoadWindowMs' not in cfg:
+        return hyperperiod
+    window = to_ticks({'Name': 'CpuLoadWindowMs', 'CpuLoadWindowMs': cfg['CpuLoadWindowMs']},
+                      'CpuLoadWindowMs', cfg['BaseTimeMs'])
+    if window == 0:
+        raise ConfigError('CpuLoadWindowMs must be at least BaseTimeMs')
+    return window
+
+
+def define(macro, value):
+    """#define line of Os_Cfg.h, kept overridable by the build for the macros of BUILD_OVERRIDABLE."""
+    line = '#define %-36s %s' % (macro, value)
+    if macro in BUILD_OVERRIDABLE:
+        return '#ifndef %s\n%s\n#endif\n' % (macro, line)
+    return line + '\n'
+
+
+def render_cfg_h(cfg, schedules):
+    tasks = cfg['Tasks']
+    out = [FILE_HEADER.format(name='Os_Cfg.h',
+                              description='Pre-Compile Configuration Header file for Os Scheduler.')]
+    out.append('#ifndef OS_CFG_H_\n#define OS_CFG_H_\n')
+    for key, macro, _, comment in SWITCHES:
+        out.append('/* %s */' % comment)
+        out.append(define(macro, '(%s)' % ('STD_ON' if cfg[key] else 'STD_OFF')))
+    server = cfg.get('AperiodicServer')
+    out.append('/* Pre-compile option for the aperiodic server: event-triggered jobs run by Os_ServerTask within a budget */')
+    out.append('#define %-36s (%s)\n' % ('OS_APERIODIC_SERVER', 'STD_ON' if server else 'STD_OFF'))
+    for key, macro, _, values, comment in OPTIONS:
+        out.append('/* %s */' % comment)
+        out.append('#define %-36s (%s)\n' % (macro, values[cfg[key]]))
+    if server:
+        out.append('/* Execution time the aperiodic server may use per replenishment period, in us */')
+        out.append('#define %-36s (%dU)\n' % ('OS_SERVER_BUDGET_US', server['BudgetUs']))
+        out.append('/* Replenishment period of the aperiodic server in ticks */')
+        out.append('#define %-36s (%dU)\n' % ('OS_SERVER_PERIOD', server['Period']))
+        out.append('/* Number of jobs the queue of the aperiodic server holds */')
+        out.append('#define %-36s (%dU)\n' % ('OS_SERVER_JOB_COUNT', server['Jobs']))
+    if cfg['TimingProtection']:
+        out.append('/* Function called on a budget overrun or a missed deadline, declared in Os.h */')
+        out.append('#define %-36s %s\n' % ('OS_PROTECTION_HOOK', cfg['ProtectionHook']))
+    out.append('/* Timer counting time in ms */')
+    out.append('#define OS_BASE_TIME                         (%dU)\n' % cfg['BaseTimeMs'])
+    out.append('/* Number of the configured Os Tasks */')
+    out.append('#define OS_TASK_COUNT                        (%dU)\n' % len(tasks))
+    out.append('/* Task Index in the array of structures in Os_PBcfg.c */')
+    for i, task in enumerate(tasks):
+        out.append('#define %-36s (Os_TaskType)%d' % (task_id_macro(task['Name']), i))
+    out.append('')
+    if cfg['SchedulingMode'] == 'Nvic':
+        out.append('/* NVIC priority of the IRQ of every task slot (IRQ OS_TASK_IRQ_BASE + n), also used by the')
+        out.append(' * Irq configuration table. The slots without a task are left at the lowest level */')
+        for i in range(MAX_NVIC_TASK_COUNT):
+            level = tasks[i]['IrqPriority'] if i < len(tasks) else LOWEST_IRQ_PRIORITY
+            out.append('#define %-36s (%dU)' % ('OS_TASK_IRQ_PRIORITY_%d' % i, level))
+        out.append('')
+    out.append('/* Number of the configured Os Resources */')
+    out.append('#define OS_RESOURCE_COUNT                    (%dU)\n' % len(cfg['Resources']))
+    if cfg['Resources']:
+        out.append('/* Resource Index in the array of structures in Os_PBcfg.c */')
+        for i, resource in enumerate(cfg['Resources']):
+            out.append('#define %-36s (Os_ResourceType)%d' % (resource_id_macro(resource['Name']), i))
+        out.append('')
+    out.append('/* Number of the configured Ioc queues */')
+    out.append('#define OS_IOC_QUEUE_COUNT                   (%dU)\n' % len(cfg['Queues']))
+    if cfg['Queues']:
+        out.append('/* Queue Index in the array of structures in Os_PBcfg.c */')
+        for i, queue in enumerate(cfg['Queues']):
+            out.append('#define %-36s (Os_QueueType)%d' % (queue_id_macro(queue['Name']), i))
+        out.append('')
+    out.append('/* Number of the configured schedules, the first one is started by the Os */')
+    out.append('#define OS_SCHEDULE_COUNT                    (%dU)\n' % len(schedules))
+    out.append('/* Schedule Index in the array of structures in Os_PBcfg.c */')
+    for i, schedule in enumerate(schedules):
+        out.append('#define %-36s (Os_ScheduleType)%d' % (schedule_id_macro(schedule['Name']), i))
+    out.append('')
+    if cfg['SchedulingMode'] == 'Preemptive':
+        out.append('/* Stack size in bytes of the idle loop in the preemptive mode */')
+        out.append('#define OS_IDLE_STACK_SIZE                   (%dU)\n' % cfg['IdleStackSize'])
+    out.append('/* Number of ticks averaged by the windowed CPU load */')
+    out.append(define('OS_CPU_LOAD_WINDOW_TICKS', '(%dU)' % cpu_load_window(cfg, schedules[0]['Hyperperiod'])))
+    out.append('/* Number of records of the trace ring buffer, a power of 2 */')
+    out.append('#define OS_TRACE_RECORD_COUNT                (%dU)\n' % cfg['TraceRecords'])
+    out.append('#endif /* OS_CFG_H_ */')
+    return '\n'.join(out) + '\n'
+
+
+def render_pbcfg_c(cfg, schedules):
+    tasks = cfg['Tasks']
+    out = [FILE_HEADER.format(name='Os_PBcfg.c',
+                              description='Post Build Configuration Source file for Os Scheduler.')]
+    out.append('#include "Os.h"')
+    for include in cfg.get('Includes', []):
+        out.append('#include "%s"' % include)
+    out.append('')
+
+    with_load = any(task['Wcet'] for task in tasks)
+    for schedule in schedules:
+        name = schedule['Name']
+        expiry_points = schedule['ExpiryPoints']
+        out.append('/*')
+        out.append(' * Expiry points of the %s schedule, one per tick that activates tasks.' % name)
+        out.append(' * The last entry marks the end of the task list of the previous one.')
+        out.append(' */')
+        out.append('static const Os_ExpiryPointType Os_ExpiryPoints_%s[%dU] = {' % (name, len(expiry_points) + 1))
+        first = 0
+        for tick, due in expiry_points:
+            comment = '%6d ms' % (tick * cfg['BaseTimeMs'])
+            if with_load:
+                comment += ', %6d us' % sum(tasks[i]['Wcet'] for i in due)
+            out.append('    { %5dU, %5dU },  /* %s */' % (tick, first, comment))
+            first += len(due)
+        out.append('    { %5dU, %5dU }' % (schedule['Hyperperiod'], first))
+        out.append('};\n')
+
+        out.append('/* Tasks activated by each expiry point of the %s schedule, in dispatch order */' % name)
+        out.append('static const Os_TaskType Os_ExpiryTasks_%s[%dU] = {' % (name, first))
+        rows = []
+        for tick, due in expiry_points:
+            rows.append('    ' + ', '.join(task_id_macro(tasks[i]['Name']) for i in due))
+        out.append(',\n'.join(rows))
+        out.append('};\n')
+
+    preemptive = cfg['SchedulingMode'] == 'Preemptive'
+    if cfg['Queues']:
+        out.append('/* Slots of the Ioc queues, and the slot ready flags of the multi-producer ones */')
+        for queue in cfg['Queues']:
+            out.append('#pragma DATA_ALIGN(%s, 4)' % queue_buffer_name(queue['Name']))
+            out.append('static uint8 %s[%dU * %dU];' % (queue_buffer_name(queue['Name']),
+                                                       queue['Length'], queue['ElementSize']))
+            if queue['MultiProducer']:
+                out.append('static volatile uint8 %s[%dU];' % (queue_ready_name(queue['Name']), queue['Length']))
+        out.append('')
+
+    if preemptive:
+        out.append('/* Stacks of the tasks in the preemptive mode */')
+        for task in tasks:
+            out.append('#pragma DATA_ALIGN(%s, 8)' % stack_name(task['Name']))
+            out.append('static uint32 %s[%dU];' % (stack_name(task['Name']), task['StackSize'] // 4))
+        out.append('')
+
+    out.append('/* PB structure used by the Os Scheduler */')
+    out.append('const Os_ConfigType Os_Configuration = {')
+    out.append('    {')
+    rows = []
+    for i, task in enumerate(tasks):
+        row = '        { %s, %dU, %dU, %dU' % (task['Name'], task['Period'], task['Offset'], task['Priority'])
+        if preemptive:
+            row += ', %s, %dU' % (stack_name(task['Name']), task['StackSize'])
+        elif cfg['SchedulingMode'] == 'Nvic':
+            row += ', OS_TASK_IRQ_PRIORITY_%d' % i
+        if cfg['TimingProtection']:
+            row += ', %dU, %dU' % (task['Budget'], task['Deadline'] or 0)
+        if cfg['LogicalExecutionTime']:
+            row += ', %s, %s' % (task['LetInput'] or 'NULL_PTR', task['LetOutput'] or 'NULL_PTR')
+        rows.append(row + ' }')
+    out.append(',\n'.join(rows))
+    out.append('    },')
+    # The optional tables follow the schedule, each member but the last one ends with a comma
+    section = ['    {']
+    last = len(schedules) - 1
+    for i, schedule in enumerate(schedules):
+        section.append('        { Os_ExpiryPoints_%s, Os_ExpiryTasks_%s, %dU, %dU }%s'
+                       % (schedule['Name'], schedule['Name'], len(schedule['ExpiryPoints']),
+                          schedule['Hyperperiod'], '' if i == last else ','))
+    section.append('    }')
+    sections = [section]
+    if cfg['Resources']:
+        section = ['    {']
+        last = len(cfg['Resources']) - 1
+        for i, resource in enumerate(cfg['Resources']):
+            row = '        { %dU' % resource['Ceiling']
+            if cfg['SchedulingMode'] == 'Nvic':
+                row += ', %dU' % resource['IrqCeiling']
+            section.append(row + ' }%s  /* %s: %s */' % ('' if i == last else ',', resource['Name'],
+                                                         ', '.join(resource['Tasks'])))
+        section.append('    }')
+        sections.append(section)
+    if cfg['Queues']:
+        section = ['    {']
+        last = len(cfg['Queues']) - 1
+        for i, queue in enumerate(cfg['Queues']):
+            ready = queue_ready_name(queue['Name']) if queue['MultiProducer'] else 'NULL_PTR'
+            section.append('        { %s, %s, %dU, %dU }%s' % (queue_buffer_name(queue['Name']), ready,
+                                                             queue['ElementSize'], queue['Length'],
+                                                             '' if i == last else ','))
+        section.append('    }')
+        sections.append(section)
+    for i, section in enumerate(sections):
+        if i != len(sections) - 1:
+            section[-1] += ','
+        out.extend(section)
+    out.append('};')
+    return '\n'.join(out) + '\n'
+
+
+def write_if_changed(path, text):
+    """Only touch the file when the content changes so CCS does not rebuild everything."""
+    if os.path.exists(path):
+        with open(path) as f:
+            if f.read() == text:
+                return
+    with open(path, 'w') as f:
+        f.write(text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate the Os Scheduler configuration.')
+    parser.add_argument('--config', default=os.path.join(PROJECT_DIR, 'Os_Cfg.json'))
+    parser.add_argument('--outdir', default=PROJECT_DIR)
+    parser.add_argument('--wcet-log', help='SWO capture of Os_DumpExecutionTimes, its longest '
+                        'execution times replace the declared WcetUs')
+    args = parser.parse_args()
+
+    try:
+        cfg = load_config(args.config)
+        if args.wcet_log:
+            load_measured_wcets(cfg, args.wcet_log)
+        schedules = load_schedules(cfg)
+        for schedule in schedules:
+            if cfg['OffsetAssignment'] == 'Auto':
+                assign_offsets(schedule['Tasks'])
+            schedule['Hyperperiod'], schedule['ExpiryPoints'] = build_schedule(schedule['Tasks'])
+    except (ConfigError, KeyError, IOError) as e:
+        sys.stderr.write('Os_Gen: error: %s\n' % e)
+        return 1
+
+    if cfg['OffsetAssignment'] == 'Auto':
+        for schedule in schedules:
+            loads = tick_loads(schedule['Tasks'], schedule['Hyperperiod'])
+            peak = max(loads)
+            print('Os_Gen: %s offsets %s, peak tick load %d us (%.1f %% of %d ms) on tick %d'
+                  % (schedule['Name'],
+                     ', '.join('%s=%d ms' % (task['Name'], task['Offset'] * cfg['BaseTimeMs'])
+                               for task in schedule['Tasks'] if task['Period']),
+                     peak, peak * 100.0 / (cfg['BaseTimeMs'] * 1000), cfg['BaseTimeMs'], loads.index(peak)))
+
+    write_if_changed(os.path.join(args.outdir, 'Os_Cfg.h'), render_cfg_h(cfg, schedules))
+    write_if_changed(os.path.join(args.outdir, 'Os_PBcfg.c'), render_pbcfg_c(cfg, schedules))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
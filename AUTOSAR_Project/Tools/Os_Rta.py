@@ -0,0 +1,215 @@
+#!/usr/bin/env python3
+###############################################################################
+#
+# Module: Os
+#
+# File Name: Os_Rta.py
+#
+# Description: Schedulability analysis of the Os task set. Reads Os_Cfg.json
+#              like Os_Gen.py (the same offsets and dispatch tables) and, for
+#              every schedule, computes the utilization and the worst-case
+#              response time, blocking and deadline slack of every task, for
+#              the cooperative executive and for the preemptive modes. Fails
+#              when a schedule is not schedulable in the configured mode, so
+#              run as a CCS pre-build step after Os_Gen.py it stops the build.
+#
+#              The execution times are the WcetUs of the tasks (BudgetUs when
+#              missing), or the longest measured ones with --wcet-log.
+#
+# Author: Mohannad Sabry
+###############################################################################
+
+import argparse
+import os
+import sys
+
+from Os_Gen import (PROJECT_DIR, SERVER_TASK_NAME, ConfigError, assign_offsets, build_schedule, lcm,
+                    load_config, load_measured_wcets, load_schedules)
+
+# Analysis used to accept or reject the schedules for each SchedulingMode
+MODE_ANALYSIS = {'Cooperative': 'Cooperative', 'Preemptive': 'Preemptive', 'Nvic': 'Preemptive'}
+
+
+def ceil_div(a, b):
+    return -(-a // b)
+
+
+def analysed_tasks(cfg, schedule):
+    """Tasks of a schedule with their timing in us, and the names of the tasks left out.
+
+    The aperiodic server is analysed as a periodic task of its budget. The other
+    event tasks have no minimum inter-arrival time to be analysed with.
+    """
+    base_us = cfg['BaseTimeMs'] * 1000
+    server = cfg.get('AperiodicServer')
+    periodic = set(task['Name'] for task in cfg['Tasks'] if task['Period'])
+    tasks = []
+    skipped = []
+    for task in schedule['Tasks']:
+        if task['Period']:
+            wcet = task['Wcet'] or task['Budget']
+            if not wcet:
+                raise ConfigError('%s: the analysis needs its WcetUs (or BudgetUs)' % task['Name'])
+            tasks.append({'Name': task['Name'], 'Periodic': True, 'PeriodTicks': task['Period'],
+                          'Period': task['Period'] * base_us, 'Deadline': task['Deadline'] * base_us,
+                          'Wcet': wcet, 'Priority': task['Priority']})
+        elif task['Name'] == SERVER_TASK_NAME and server:
+            tasks.append({'Name': task['Name'], 'Periodic': False, 'PeriodTicks': server['Period'],
+                          'Period': server['Period'] * base_us, 'Deadline': server['Period'] * base_us,
+                          'Wcet': server['BudgetUs'], 'Priority': task['Priority']})
+        elif task['Name'] not in periodic:
+            skipped.append(task['Name'])
+    return tasks, skipped
+
+
+def resource_blocking(task, tasks, resources):
+    """Immediate priority ceiling: a task is blocked at most once, by one lower priority task
+    holding a resource whose ceiling is at or above its priority. The hold time is the
+    MaxHoldUs of the resource, the WCET of the holder when not given."""
+    by_name = dict((other['Name'], other) for other in tasks)
+    blocking = 0
+    for resource in resources:
+        if resource['Ceiling'] < task['Priority']:
+            continue
+        for user in resource['Tasks']:
+            other = by_name.get(user)
+            if other and other['Priority'] < task['Priority']:
+                blocking = max(blocking, resource['MaxHoldUs'] or other['Wcet'])
+    return blocking
+
+
+def analyse_preemptive(tasks, resources):
+    """Fixed-priority preemptive response-time analysis.
+
+    R = C + B + sum over the higher priority tasks of ceil(R / T) * C, iterated to
+    its fixed point. All the tasks are taken as released together, which ignores the
+    offsets and can only overestimate the response times.
+    """
+    results = {}
+    for task in tasks:
+        higher = [other for other in tasks if other['Priority'] > task['Priority']]
+        blocking = resource_blocking(task, tasks, resources)
+        response = task['Wcet'] + blocking
+        while True:
+            demand = task['Wcet'] + blocking + sum(ceil_div(response, other['Period']) * other['Wcet']
+                                                   for other in higher)
+            if demand == response or demand > task['Deadline']:
+                response = demand
+                break
+            response = demand
+        results[task['Name']] = {'Blocking': blocking, 'Response': response}
+    return results, True
+
+
+def analyse_cooperative(tasks, schedule, base_us):
+    """Response times of the cooperative executive, simulated over the dispatch table.
+
+    The tasks of a tick run back to back in dispatch order once the work left from the
+    previous ticks is done. The aperiodic server only runs when no tick is pending and
+    is not preempted, so a run started just before a tick delays its tasks by up to the
+    budget, once per server period: every alignment of that blocking is tried. Two
+    cycles are simulated so the backlog carried into the second one is included, a
+    backlog still growing at the end of it means the executive is overloaded.
+    """
+    by_name = dict((task['Name'], task) for task in tasks)
+    servers = [task for task in tasks if not task['Periodic']]
+    blocking = max([task['Wcet'] for task in servers] or [0])
+    block_period = servers[0]['PeriodTicks'] if servers else 1
+    cycle = lcm(schedule['Hyperperiod'], block_period)
+    expiry_points = dict(schedule['ExpiryPoints'])
+
+    responses = dict((task['Name'], 0) for task in tasks)
+    stable = True
+    for alignment in range(block_period):
+        busy_until = 0
+        backlogs = []
+        for tick in range(2 * cycle):
+            release = tick * base_us
+            if busy_until <= release:
+                busy_until = release
+                if blocking and tick % block_period == alignment:
+                    busy_until += blocking
+            for index in expiry_points.get(tick % schedule['Hyperperiod'], []):
+                task = by_name[schedule['Tasks'][index]['Name']]
+                busy_until += task['Wcet']
+                responses[task['Name']] = max(responses[task['Name']], busy_until - release)
+            if (tick + 1) % cycle == 0:
+                backlogs.append(max(0, busy_until - (tick + 1) * base_us))
+        if backlogs[1] > backlogs[0]:
+            stable = False
+    # A server run waits at most for the work of the ticks pending when it is activated
+    tick_busy = max([responses[task['Name']] for task in tasks if task['Periodic']] or [0])
+    for task in servers:
+        responses[task['Name']] = tick_busy + task['Wcet']
+
+    results = dict((task['Name'], {'Blocking': blocking if task['Periodic'] else 0,
+                                   'Response': responses[task['Name']]}) for task in tasks)
+    return results, stable
+
+
+def report(title, tasks, results, stable):
+    """Print the analysis of one schedule, return True if every task meets its deadline."""
+    utilization = sum(float(task['Wcet']) / task['Period'] for task in tasks)
+    feasible = stable and utilization <= 1.0
+    print('Os_Rta: %s, utilization %.1f %%' % (title, utilization * 100.0))
+    print('    %-16s %9s %9s %7s %9s %9s %9s' % ('Task', 'Period', 'Deadline', 'WCET', 'Blocking', 'Response', 'Slack'))
+    for task in sorted(tasks, key=lambda task: -task['Priority']):
+        result = results[task['Name']]
+        slack = task['Deadline'] - result['Response']
+        feasible = feasible and slack >= 0
+        print('    %-16s %9d %9d %7d %9d %9d %9d%s' % (task['Name'], task['Period'], task['Deadline'], task['Wcet'],
+                                                   result['Blocking'], result['Response'], slack,
+                                                   '' if slack >= 0 else '  DEADLINE MISS'))
+    if not stable:
+        print('    overloaded: the backlog of the ticks keeps growing')
+    return feasible
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Schedulability analysis of the Os task set (times in us).')
+    parser.add_argument('--config', default=os.path.join(PROJECT_DIR, 'Os_Cfg.json'))
+    parser.add_argument('--wcet-log', help='SWO capture of Os_DumpExecutionTimes, its longest '
+                        'execution times replace the declared WcetUs')
+    parser.add_argument('--mode', choices=sorted(set(MODE_ANALYSIS.values())),
+                        help='analysis that decides the result (default: the one of the SchedulingMode)')
+    args = parser.parse_args()
+
+    try:
+        cfg = load_config(args.config)
+        if args.wcet_log:
+            load_measured_wcets(cfg, args.wcet_log)
+        schedules = load_schedules(cfg)
+        for schedule in schedules:
+            if cfg['OffsetAssignment'] == 'Auto':
+                assign_offsets(schedule['Tasks'])
+            schedule['Hyperperiod'], schedule['ExpiryPoints'] = build_schedule(schedule['Tasks'])
+        analysed = [analysed_tasks(cfg, schedule) for schedule in schedules]
+    except (ConfigError, KeyError, IOError) as e:
+        sys.stderr.write('Os_Rta: error: %s\n' % e)
+        return 1
+
+    mode = args.mode or MODE_ANALYSIS[cfg['SchedulingMode']]
+    base_us = cfg['BaseTimeMs'] * 1000
+    failed = []
+    for schedule, (tasks, skipped) in zip(schedules, analysed):
+        results = {
+            'Cooperative': analyse_cooperative(tasks, schedule, base_us),
+            'Preemptive': analyse_preemptive(tasks, cfg['Resources']),
+        }
+        for analysis in ('Cooperative', 'Preemptive'):
+            title = 'schedule %s, %s%s' % (schedule['Name'], analysis.lower(),
+                                           ' (configured)' if analysis == mode else '')
+            feasible = report(title, tasks, *results[analysis])
+            if analysis == mode and not feasible:
+                failed.append(schedule['Name'])
+        if skipped:
+            print('    not analysed (event tasks): %s' % ', '.join(skipped))
+
+    if failed:
+        sys.stderr.write('Os_Rta: error: not schedulable in the %s mode: %s\n' % (mode, ', '.join(failed)))
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
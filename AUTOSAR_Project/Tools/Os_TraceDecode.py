@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+###############################################################################
+#
+# Module: Os
+#
+# File Name: Os_TraceDecode.py
+#
+# Description: Decoder of the Os trace recorder (Os_Trace.c). Reads a memory
+#              dump taken with the debugger, finds Os_TraceRecorder in it with
+#              the address from Debug/AUTOSAR_Project.map and writes the
+#              records as Chrome trace JSON, to be opened in Perfetto
+#              (ui.perfetto.dev) or chrome://tracing.
+#
+#              The dump is either a raw binary file or a CCS "TI Data" file
+#              (Memory Browser > Save Memory), it may start at the recorder or
+#              hold a larger region such as the whole SRAM.
+#
+# Author: Mohannad Sabry
+###############################################################################
+
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+
+from Os_Gen import PROJECT_DIR, ConfigError, load_config
+
+# Must match Os_Trace.h
+TRACE_SYMBOL = 'Os_TraceRecorder'
+TRACE_MAGIC = 0x5254534F
+TRACE_VERSION = 1
+HEADER = struct.Struct('<IHHII')
+RECORD = struct.Struct('<IBBH')
+
+EVENT_TASK_START = 1
+EVENT_TASK_END = 2
+EVENT_ISR_ENTER = 3
+EVENT_ISR_EXIT = 4
+EVENT_MARKER = 5
+
+ISR_NAMES = {0: 'SysTick_Handler', 1: 'Gpt_SubTimerHandler'}
+
+# Chrome trace thread ids: one track per task and per ISR
+TASK_TID_BASE = 100
+ISR_TID_BASE = 200
+
+# First word of a CCS TI Data file
+TI_DATA_MAGIC = '1651'
+
+
+class TraceError(Exception):
+    pass
+
+
+def find_symbol(map_path, symbol):
+    """Address of a global symbol in a TI linker map file."""
+    pattern = re.compile(r'^\s*([0-9a-fA-F]{8})\s+_?%s\s*$' % re.escape(symbol))
+    with open(map_path) as f:
+        for line in f:
+            match = pattern.match(line)
+            if match:
+                return int(match.group(1), 16)
+    raise TraceError('%s not found in %s' % (symbol, map_path))
+
+
+def read_dump(path, base):
+    """Return (start address, bytes) of the dump, the TI Data header gives its own address."""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:4].decode('ascii', 'replace') == TI_DATA_MAGIC:
+        # Header: magic, format, start address, page, length in words; then one 32-bit hex word per line
+        lines = data.decode('ascii').split()
+        address = int(lines[2], 16)
+        words = [int(word, 16) for word in lines[5:]]
+        return address, struct.pack('<%dI' % len(words), *words)
+    return base, data
+
+
+def read_records(address, data, recorder):
+    offset = recorder - address
+    if offset < 0 or offset + HEADER.size > len(data):
+        raise TraceError('the dump (0x%08X, %d bytes) does not hold %s at 0x%08X'
+                         % (address, len(data), TRACE_SYMBOL, recorder))
+    magic, version, capacity, clock_hz, written = HEADER.unpack_from(data, offset)
+    if magic != TRACE_MAGIC:
+        raise TraceError('no recorder at 0x%08X (bad magic 0x%08X), was Os_start reached?' % (recorder, magic))
+    if version != TRACE_VERSION:
+        raise TraceError('recorder version %d, this decoder reads version %d' % (version, TRACE_VERSION))
+    offset += HEADER.size
+    if offset + capacity * RECORD.size > len(data):
+        raise TraceError('the dump ends before the %d records of the recorder' % capacity)
+
+    # Oldest record first: once the buffer wrapped around it is the one to be overwritten next
+    if written <= capacity:
+        order = range(written)
+    else:
+        order = [(written + i) % capacity for i in range(capacity)]
+    records = [RECORD.unpack_from(data, offset + i * RECORD.size) for i in order]
+    return clock_hz, written, records
+
+
+def to_chrome_trace(records, clock_hz, task_names, marker_names):
+    events = [{'ph': 'M', 'pid': 1, 'name': 'process_name', 'args': {'name': 'Os'}}]
+    tracks = set()
+    open_slices = {}
+    time = 0
+    last = records[0][0] if records else 0
+
+    for timestamp, event, ident, data in records:
+        # The 32-bit cycle counter wraps around, the records are in time order
+        time += (timestamp - last) & 0xFFFFFFFF
+        last = timestamp
+        ts = time * 1e6 / clock_hz
+
+        if event in (EVENT_TASK_START, EVENT_TASK_END):
+            tid = TASK_TID_BASE + ident
+            name = task_names[ident] if ident < len(task_names) else 'Task %d' % ident
+            begin = event == EVENT_TASK_START
+        elif event in (EVENT_ISR_ENTER, EVENT_ISR_EXIT):
+            tid = ISR_TID_BASE + ident
+            name = ISR_NAMES.get(ident, 'ISR %d' % ident)
+            begin = event == EVENT_ISR_ENTER
+        elif event == EVENT_MARKER:
+            events.append({'ph': 'i', 's': 'p', 'pid': 1, 'tid': 0, 'ts': ts,
+                           'name': marker_names.get(ident, 'Marker %d' % ident), 'args': {'value': data}})
+            continue
+        else:
+            raise TraceError('unknown event %d, the dump is not a consistent recorder' % event)
+
+        if tid not in tracks:
+            tracks.add(tid)
+            events.append({'ph': 'M', 'pid': 1, 'tid': tid, 'name': 'thread_name', 'args': {'name': name}})
+            events.append({'ph': 'M', 'pid': 1, 'tid': tid, 'name': 'thread_sort_index', 'args': {'sort_index': tid}})
+        if begin:
+            open_slices[tid] = open_slices.get(tid, 0) + 1
+        elif open_slices.get(tid, 0) > 0:
+            open_slices[tid] -= 1
+        else:
+            # Its start was overwritten in the ring buffer
+            continue
+        events.append({'ph': 'B' if begin else 'E', 'pid': 1, 'tid': tid, 'ts': ts, 'name': name})
+
+    return {'traceEvents': events, 'displayTimeUnit': 'ns'}
+
+
+def parse_markers(values):
+    markers = {}
+    for value in values:
+        ident, _, name = value.partition('=')
+        if not ident.isdigit() or not name:
+            raise TraceError('--marker takes ID=NAME, got %s' % value)
+        markers[int(ident)] = name
+    return markers
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode an Os trace dump into Chrome trace JSON.')
+    parser.add_argument('dump', help='raw binary or CCS TI Data memory dump holding Os_TraceRecorder')
+    parser.add_argument('-o', '--output', default='trace.json')
+    parser.add_argument('--map', default=os.path.join(PROJECT_DIR, 'Debug', 'AUTOSAR_Project.map'))
+    parser.add_argument('--config', default=os.path.join(PROJECT_DIR, 'Os_Cfg.json'),
+                        help='task configuration, gives the task names')
+    parser.add_argument('--base', type=lambda value: int(value, 0),
+                        help='address of the first byte of a raw dump (default: the recorder address)')
+    parser.add_argument('--marker', action='append', default=[], metavar='ID=NAME',
+                        help='name of a user marker, may be repeated')
+    args = parser.parse_args()
+
+    try:
+        recorder = find_symbol(args.map, TRACE_SYMBOL)
+        address, data = read_dump(args.dump, recorder if args.base is None else args.base)
+        clock_hz, written, records = read_records(address, data, recorder)
+        task_names = [task['Name'] for task in load_config(args.config)['Tasks']]
+        trace = to_chrome_trace(records, clock_hz, task_names, parse_markers(args.marker))
+    except (TraceError, ConfigError, KeyError, OSError, ValueError) as e:
+        sys.stderr.write('Os_TraceDecode: error: %s\n' % e)
+        return 1
+
+    with open(args.output, 'w') as f:
+        json.dump(trace, f)
+    sys.stdout.write('Os_TraceDecode: %d records (%d written) -> %s\n' % (len(records), written, args.output))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
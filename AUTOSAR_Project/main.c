@@ -1,7 +1,11 @@
+#include "Irq.h"
 #include "Os.h"
 
 int main(void)
 {
+    /* Set the priority of every vector before any interrupt is enabled */
+    Irq_Init(&Irq_Configuration);
+
     /* Start the Os */
     Os_start();
 }
@@ -35,7 +35,7 @@ SECTIONS
     .pinit  :   > FLASH
     .init_array : > FLASH
 
-    .vtable :   > 0x20000000
+    .vtable :   > 0x20000000, type = NOINIT   /* filled by ResetISR before cinit */
     .data   :   > SRAM
     .bss    :   > SRAM
     .sysmem :   > SRAM
@@ -1,7 +1,7 @@
 #ifndef TM4C123GH6PM_REGISTERS
 #define TM4C123GH6PM_REGISTERS
 
-#include "std_types.h"
+#include "Std_Types.h"
 
 /*****************************************************************************
 GPIO registers (PORTA)
@@ -142,6 +142,18 @@ Systick Timer Registers
 #define SYSTICK_RELOAD_REG        (*((volatile uint32 *)0xE000E014))
 #define SYSTICK_CURRENT_REG       (*((volatile uint32 *)0xE000E018))
 
+/*****************************************************************************
+Wide Timer 5 Registers
+*****************************************************************************/
+#define WTIMER5_CFG_REG           (*((volatile uint32 *)0x4004F000))
+#define WTIMER5_TAMR_REG          (*((volatile uint32 *)0x4004F004))
+#define WTIMER5_CTL_REG           (*((volatile uint32 *)0x4004F00C))
+#define WTIMER5_IMR_REG           (*((volatile uint32 *)0x4004F018))
+#define WTIMER5_RIS_REG           (*((volatile uint32 *)0x4004F01C))
+#define WTIMER5_ICR_REG           (*((volatile uint32 *)0x4004F024))
+#define WTIMER5_TAILR_REG         (*((volatile uint32 *)0x4004F028))
+#define WTIMER5_TAV_REG           (*((volatile uint32 *)0x4004F050))
+
 /*****************************************************************************
 NVIC Registers
 *****************************************************************************/
@@ -191,6 +203,22 @@ NVIC Registers
 #define NVIC_DIS2_REG             (*((volatile uint32 *)0xE000E188))
 #define NVIC_DIS3_REG             (*((volatile uint32 *)0xE000E18C))
 #define NVIC_DIS4_REG             (*((volatile uint32 *)0xE000E190))
+#define NVIC_PEND0_REG            (*((volatile uint32 *)0xE000E200))
+#define NVIC_PEND1_REG            (*((volatile uint32 *)0xE000E204))
+#define NVIC_PEND2_REG            (*((volatile uint32 *)0xE000E208))
+#define NVIC_PEND3_REG            (*((volatile uint32 *)0xE000E20C))
+#define NVIC_PEND4_REG            (*((volatile uint32 *)0xE000E210))
+#define NVIC_UNPEND0_REG          (*((volatile uint32 *)0xE000E280))
+#define NVIC_UNPEND1_REG          (*((volatile uint32 *)0xE000E284))
+#define NVIC_UNPEND2_REG          (*((volatile uint32 *)0xE000E288))
+#define NVIC_UNPEND3_REG          (*((volatile uint32 *)0xE000E28C))
+#define NVIC_UNPEND4_REG          (*((volatile uint32 *)0xE000E290))
+#define NVIC_ACTIVE0_REG          (*((volatile uint32 *)0xE000E300))
+#define NVIC_ACTIVE1_REG          (*((volatile uint32 *)0xE000E304))
+#define NVIC_ACTIVE2_REG          (*((volatile uint32 *)0xE000E308))
+#define NVIC_ACTIVE3_REG          (*((volatile uint32 *)0xE000E30C))
+#define NVIC_ACTIVE4_REG          (*((volatile uint32 *)0xE000E310))
+#define NVIC_SW_TRIG_REG          (*((volatile uint32 *)0xE000EF00))
 
 /*****************************************************************************
 System Control Block Registers
@@ -200,8 +228,19 @@ System Control Block Registers
 #define NVIC_SYSTEM_PRI3_REG      (*((volatile uint32 *)0xE000ED20))
 #define NVIC_SYSTEM_SYSHNDCTRL    (*((volatile uint32 *)0xE000ED24))
 #define NVIC_SYSTEM_INTCTRL       (*((volatile uint32 *)0xE000ED04))
+#define NVIC_SYSTEM_APINT         (*((volatile uint32 *)0xE000ED0C))
 #define NVIC_SYSTEM_CFGCTRL       (*((volatile uint32 *)0xE000ED14))
 
+/*****************************************************************************
+Debug Registers (Core Debug, DWT and ITM)
+*****************************************************************************/
+#define CORE_DEBUG_DEMCR_REG      (*((volatile uint32 *)0xE000EDFC))
+#define DWT_CTRL_REG              (*((volatile uint32 *)0xE0001000))
+#define DWT_CYCCNT_REG            (*((volatile uint32 *)0xE0001004))
+#define ITM_STIM0_REG             (*((volatile uint32 *)0xE0000000))
+#define ITM_TER_REG               (*((volatile uint32 *)0xE0000E00))
+#define ITM_TCR_REG               (*((volatile uint32 *)0xE0000E80))
+
 /*****************************************************************************
 MPU Registers
 *****************************************************************************/
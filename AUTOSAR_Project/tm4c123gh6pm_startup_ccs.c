@@ -34,6 +34,9 @@ static void NmiSR(void);
 static void FaultISR(void);
 static void IntDefaultHandler(void);
 extern void SysTick_Handler(void);
+extern void PendSV_Handler(void);
+extern void Os_TaskIrqHandler(void);
+extern void Os_ProtectionTimerHandler(void);
 
 //*****************************************************************************
 //
@@ -45,17 +48,35 @@ extern void _c_int00(void);
 
 //*****************************************************************************
 //
-// Linker variable that marks the top of the stack.
+// Linker variables that mark the bottom and the top of the stack.
 //
 //*****************************************************************************
+extern uint32_t __stack;
 extern uint32_t __STACK_TOP;
 
+//*****************************************************************************
+//
+// Pattern the unused stack is painted with, it must match
+// OS_STACK_PAINT_PATTERN in Os_Kernel.h.
+//
+//*****************************************************************************
+#define STACK_PAINT_PATTERN     0xA5A5A5A5
+
+//*****************************************************************************
+//
+// Number of the vectors and the Vector Table Offset Register. The copy of the
+// vector table in RAM must be aligned on a power of two larger than its size.
+//
+//*****************************************************************************
+#define NUM_VECTORS             155
+#define NVIC_VTABLE_R           (*((volatile uint32_t *)0xE000ED08))
+
 //*****************************************************************************
 //
 // External declarations for the interrupt handlers used by the application.
 //
 //*****************************************************************************
-// To be added by user
+// The driver handlers are installed at run time with Irq_Register
 
 //*****************************************************************************
 //
@@ -65,7 +86,7 @@ extern uint32_t __STACK_TOP;
 //
 //*****************************************************************************
 #pragma DATA_SECTION(g_pfnVectors, ".intvecs")
-void (* const g_pfnVectors[])(void) =
+void (* const g_pfnVectors[NUM_VECTORS])(void) =
 {
     (void (*)(void))((uint32_t)&__STACK_TOP),
                                             // The initial stack pointer
@@ -82,7 +103,7 @@ void (* const g_pfnVectors[])(void) =
     IntDefaultHandler,                      // SVCall handler
     IntDefaultHandler,                      // Debug monitor handler
     0,                                      // Reserved
-    IntDefaultHandler,                      // The PendSV handler
+    PendSV_Handler,                         // The PendSV handler
     SysTick_Handler,                        // The SysTick handler
     IntDefaultHandler,                      // GPIO Port A
     IntDefaultHandler,                      // GPIO Port B
@@ -141,13 +162,13 @@ void (* const g_pfnVectors[])(void) =
     IntDefaultHandler,                      // GPIO Port J
     IntDefaultHandler,                      // GPIO Port K
     IntDefaultHandler,                      // GPIO Port L
-    IntDefaultHandler,                      // SSI2 Rx and Tx
-    IntDefaultHandler,                      // SSI3 Rx and Tx
-    IntDefaultHandler,                      // UART3 Rx and Tx
-    IntDefaultHandler,                      // UART4 Rx and Tx
-    IntDefaultHandler,                      // UART5 Rx and Tx
-    IntDefaultHandler,                      // UART6 Rx and Tx
-    IntDefaultHandler,                      // UART7 Rx and Tx
+    Os_TaskIrqHandler,                      // SSI2 Rx and Tx (Os task 0 in NVIC mode)
+    Os_TaskIrqHandler,                      // SSI3 Rx and Tx (Os task 1 in NVIC mode)
+    Os_TaskIrqHandler,                      // UART3 Rx and Tx (Os task 2 in NVIC mode)
+    Os_TaskIrqHandler,                      // UART4 Rx and Tx (Os task 3 in NVIC mode)
+    Os_TaskIrqHandler,                      // UART5 Rx and Tx (Os task 4 in NVIC mode)
+    Os_TaskIrqHandler,                      // UART6 Rx and Tx (Os task 5 in NVIC mode)
+    Os_TaskIrqHandler,                      // UART7 Rx and Tx (Os task 6 in NVIC mode)
     0,                                      // Reserved
     0,                                      // Reserved
     0,                                      // Reserved
@@ -188,7 +209,7 @@ void (* const g_pfnVectors[])(void) =
     IntDefaultHandler,                      // Wide Timer 3 subtimer B
     IntDefaultHandler,                      // Wide Timer 4 subtimer A
     IntDefaultHandler,                      // Wide Timer 4 subtimer B
-    IntDefaultHandler,                      // Wide Timer 5 subtimer A
+    Os_ProtectionTimerHandler,              // Wide Timer 5 subtimer A (Os budget timer)
     IntDefaultHandler,                      // Wide Timer 5 subtimer B
     IntDefaultHandler,                      // FPU
     0,                                      // Reserved
@@ -225,6 +246,20 @@ void (* const g_pfnVectors[])(void) =
     IntDefaultHandler                       // PWM 1 Fault
 };
 
+//*****************************************************************************
+//
+// The vector table in use after reset: a copy of g_pfnVectors in the .vtable
+// section, where Irq_Register installs the handlers of the drivers. ResetISR
+// fills it before _c_int00, so it must be left out of the zero-init of the
+// C runtime: NOINIT here and type=NOINIT for .vtable in tm4c123gh6pm.cmd,
+// otherwise cinit clears it while VTOR already points at it.
+//
+//*****************************************************************************
+#pragma DATA_SECTION(g_pfnRAMVectors, ".vtable")
+#pragma NOINIT(g_pfnRAMVectors)
+#pragma DATA_ALIGN(g_pfnRAMVectors, 1024)
+void (*g_pfnRAMVectors[NUM_VECTORS])(void);
+
 //*****************************************************************************
 //
 // This is the code that gets called when the processor first starts execution
@@ -238,6 +273,32 @@ void (* const g_pfnVectors[])(void) =
 void
 ResetISR(void)
 {
+    volatile uint32_t ui32StackMarker;
+    uint32_t *pui32Stack;
+    uint32_t ui32Vector;
+
+    //
+    // Paint the stack from its bottom up to a few words below the frame of
+    // this function, so the Os can find the deepest stack usage later on.
+    //
+    for(pui32Stack = &__stack; pui32Stack < (&ui32StackMarker - 8);
+        pui32Stack++)
+    {
+        *pui32Stack = STACK_PAINT_PATTERN;
+    }
+
+    //
+    // Copy the vector table to RAM and use it from now on, so the drivers can
+    // install their interrupt handlers with Irq_Register.
+    //
+    for(ui32Vector = 0; ui32Vector < NUM_VECTORS; ui32Vector++)
+    {
+        g_pfnRAMVectors[ui32Vector] = g_pfnVectors[ui32Vector];
+    }
+    NVIC_VTABLE_R = (uint32_t)g_pfnRAMVectors;
+    __asm("    dsb\n"
+          "    isb");
+
     //
     // Jump to the CCS C initialization routine.  This will enable the
     // floating-point unit as well, so that does not need to be done here.